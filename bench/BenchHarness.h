@@ -0,0 +1,216 @@
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+// 微基准测试框架（单头文件，无外部依赖）
+// 每个测试是一个函数，在 state.iterations 次循环中执行被测操作；
+// 准备工作可以放在 pause()/resume() 之间，不计入耗时。
+// 先自动确定循环次数（单次运行不少于 MIN_RUN_SECONDS），再重复 REPETITIONS 次，
+// 报告中位数和最小值；结果可以写成 JSON，并与之前保存的 JSON 对比找出变慢的测试。
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+// 防止被测结果被编译器优化掉
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+class State {
+public:
+    explicit State(std::size_t iterations) : iterations(iterations), elapsed(0.0), paused(true) {}
+
+    const std::size_t iterations;
+
+    // 暂停/继续计时
+    void pause() {
+        if (paused) return;
+        elapsed += std::chrono::duration<double>(Clock::now() - start).count();
+        paused = true;
+    }
+
+    void resume() {
+        if (!paused) return;
+        start = Clock::now();
+        paused = false;
+    }
+
+    double getElapsedSeconds() const { return elapsed; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point start;
+    double elapsed;
+    bool paused;
+};
+
+struct Case {
+    std::string name;
+    std::size_t itemsPerIteration;  // 每次循环处理的元素数（粒子、实体），用于计算吞吐量
+    std::function<void(State&)> function;
+};
+
+struct Result {
+    std::string name;
+    std::size_t iterations;
+    double medianNs;  // 每次循环的耗时（纳秒）
+    double minNs;
+    double itemsPerSecond;
+};
+
+class Runner {
+public:
+    static constexpr double MIN_RUN_SECONDS = 0.1;
+    static constexpr int REPETITIONS = 5;
+
+    void add(const std::string& name, std::size_t itemsPerIteration, std::function<void(State&)> function) {
+        cases.push_back({ name, itemsPerIteration, std::move(function) });
+    }
+
+    // 运行名称包含 filter 的测试（filter 为空时运行全部）
+    std::vector<Result> run(const std::string& filter) const {
+        std::vector<Result> results;
+        std::printf("%-44s %12s %14s %14s %16s\n", "benchmark", "iterations", "median ns", "min ns", "items/s");
+
+        for (const Case& benchCase : cases) {
+            if (!filter.empty() && benchCase.name.find(filter) == std::string::npos) continue;
+
+            std::size_t iterations = calibrate(benchCase);
+            std::vector<double> samples;
+            for (int i = 0; i < REPETITIONS; i++) {
+                samples.push_back(runOnce(benchCase, iterations) * 1e9 / iterations);
+            }
+            std::sort(samples.begin(), samples.end());
+
+            Result result;
+            result.name = benchCase.name;
+            result.iterations = iterations;
+            result.medianNs = samples[samples.size() / 2];
+            result.minNs = samples.front();
+            result.itemsPerSecond = benchCase.itemsPerIteration * 1e9 / result.medianNs;
+            results.push_back(result);
+
+            std::printf("%-44s %12zu %14.1f %14.1f %16.0f\n", result.name.c_str(), result.iterations,
+                        result.medianNs, result.minNs, result.itemsPerSecond);
+        }
+
+        return results;
+    }
+
+private:
+    std::vector<Case> cases;
+
+    static double runOnce(const Case& benchCase, std::size_t iterations) {
+        State state(iterations);
+        state.resume();
+        benchCase.function(state);
+        state.pause();
+        return state.getElapsedSeconds();
+    }
+
+    // 循环次数翻倍直到单次运行足够长
+    static std::size_t calibrate(const Case& benchCase) {
+        std::size_t iterations = 1;
+        while (true) {
+            double seconds = runOnce(benchCase, iterations);
+            if (seconds >= MIN_RUN_SECONDS || iterations >= (1u << 30)) break;
+
+            double scale = seconds > 0.0 ? MIN_RUN_SECONDS / seconds * 1.2 : 10.0;
+            iterations = static_cast<std::size_t>(iterations * std::min(std::max(scale, 2.0), 10.0));
+        }
+        return iterations;
+    }
+};
+
+// 写出 JSON（每个结果一行，便于对比和版本控制中查看差异）
+inline bool writeJson(const std::string& path, const std::string& suite, const std::vector<Result>& results) {
+    std::ofstream file(path);
+    if (!file) {
+        std::fprintf(stderr, "Failed to write %s\n", path.c_str());
+        return false;
+    }
+
+#ifdef NDEBUG
+    const char* buildType = "release";
+#else
+    const char* buildType = "debug";
+#endif
+
+    file << "{\n";
+    file << "  \"suite\": \"" << suite << "\",\n";
+    file << "  \"build\": \"" << buildType << "\",\n";
+    file << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const Result& result = results[i];
+        char line[512];
+        std::snprintf(line, sizeof(line),
+                      "    {\"name\": \"%s\", \"iterations\": %zu, \"median_ns\": %.3f, \"min_ns\": %.3f, "
+                      "\"items_per_second\": %.1f}%s\n",
+                      result.name.c_str(), result.iterations, result.medianNs, result.minNs,
+                      result.itemsPerSecond, i + 1 < results.size() ? "," : "");
+        file << line;
+    }
+    file << "  ]\n";
+    file << "}\n";
+    return true;
+}
+
+// 读取 writeJson 写出的文件中每个测试的中位数耗时
+inline bool readJson(const std::string& path, std::vector<Result>& results) {
+    std::ifstream file(path);
+    if (!file) {
+        std::fprintf(stderr, "Failed to read %s\n", path.c_str());
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        std::size_t nameKey = line.find("\"name\": \"");
+        std::size_t medianKey = line.find("\"median_ns\": ");
+        if (nameKey == std::string::npos || medianKey == std::string::npos) continue;
+
+        std::size_t nameBegin = nameKey + 9;
+        Result result = {};
+        result.name = line.substr(nameBegin, line.find('"', nameBegin) - nameBegin);
+        result.medianNs = std::atof(line.c_str() + medianKey + 13);
+        results.push_back(result);
+    }
+    return true;
+}
+
+// 与基准结果对比，列出变慢超过 threshold（0.1 表示 10%）的测试，返回变慢的数量
+inline int compare(const std::vector<Result>& baseline, const std::vector<Result>& current, double threshold) {
+    int regressions = 0;
+    std::printf("\n%-44s %14s %14s %9s\n", "benchmark", "baseline ns", "current ns", "change");
+
+    for (const Result& result : current) {
+        auto match = std::find_if(baseline.begin(), baseline.end(),
+                                  [&result](const Result& base) { return base.name == result.name; });
+        if (match == baseline.end() || match->medianNs <= 0.0) continue;
+
+        double change = result.medianNs / match->medianNs - 1.0;
+        bool regressed = change > threshold;
+        regressions += regressed ? 1 : 0;
+        std::printf("%-44s %14.1f %14.1f %+8.1f%%%s\n", result.name.c_str(), match->medianNs,
+                    result.medianNs, change * 100.0, regressed ? "  REGRESSION" : "");
+    }
+    return regressions;
+}
+
+}
+
+#endif
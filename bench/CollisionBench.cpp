@@ -0,0 +1,153 @@
+// 碰撞检测性能测试
+// 对比逐对检测（子弹 x 障碍物）与空间哈希网格在 1k / 10k 实体时每帧的耗时，
+// 并检查两种方法找到的接触完全一致
+#include "systems/CollisionSystem.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    // 子弹占实体总数的比例（无限弹药的改版）
+    const float BULLET_FRACTION = 0.2f;
+
+    // 平均每个实体占用的世界面积（边长，像素）
+    const float SPACING = 100.0f;
+
+    struct Scene {
+        EntityRegistry registry;
+        float worldSize;
+
+        explicit Scene(std::size_t count) : registry(count) {
+            worldSize = std::sqrt(static_cast<float>(count)) * SPACING;
+
+            std::mt19937 engine(12345);
+            std::uniform_real_distribution<float> position(0.0f, worldSize);
+            std::size_t bulletCount = static_cast<std::size_t>(count * BULLET_FRACTION);
+
+            for (std::size_t i = 0; i < count; i++) {
+                bool bullet = i < bulletCount;
+                Entity entity = registry.create();
+
+                Transform transform;
+                transform.position = sf::Vector2f(position(engine), position(engine));
+                registry.transforms.add(entity, transform);
+
+                Collider collider;
+                float extent = bullet ? 8.0f : 20.0f;
+                collider.halfSize = sf::Vector2f(extent, extent);
+                collider.layer = bullet ? CollisionLayer::Bullet : CollisionLayer::Obstacle;
+                registry.colliders.add(entity, collider);
+            }
+        }
+
+        // 每帧所有实体移动一段距离，循环回到世界内
+        void step(int frame) {
+            Transform* transforms = registry.transforms.data();
+            for (std::size_t i = 0; i < registry.transforms.size(); i++) {
+                float offset = (i % 2 == 0) ? 7.0f : -5.0f;
+                transforms[i].position.y = std::fmod(transforms[i].position.y + offset + worldSize, worldSize);
+                transforms[i].position.x = std::fmod(transforms[i].position.x + (frame % 3) + worldSize, worldSize);
+            }
+        }
+    };
+
+    // 逐对检测：与 CollisionSystem::findContacts 相同的语义
+    void bruteForceContacts(const EntityRegistry& registry, std::vector<CollisionSystem::Contact>& contacts) {
+        struct Proxy {
+            sf::FloatRect bounds;
+            Entity entity;
+        };
+        static std::vector<Proxy> bullets;
+        static std::vector<Proxy> obstacles;
+        static std::vector<std::uint8_t> consumed;
+        bullets.clear();
+        obstacles.clear();
+        contacts.clear();
+
+        const Collider* colliders = registry.colliders.data();
+        const Entity* entities = registry.colliders.entities();
+        for (std::size_t i = 0; i < registry.colliders.size(); i++) {
+            Proxy proxy = { colliders[i].getBounds(registry.transforms.get(entities[i])), entities[i] };
+            (colliders[i].layer == CollisionLayer::Bullet ? bullets : obstacles).push_back(proxy);
+        }
+        consumed.assign(obstacles.size(), 0);
+
+        for (const Proxy& bullet : bullets) {
+            for (std::size_t j = 0; j < obstacles.size(); j++) {
+                if (consumed[j] || !bullet.bounds.intersects(obstacles[j].bounds)) continue;
+                consumed[j] = 1;
+                contacts.push_back({ bullet.entity, obstacles[j].entity });
+                break;
+            }
+        }
+    }
+
+    bool sameContacts(const std::vector<CollisionSystem::Contact>& a, const std::vector<CollisionSystem::Contact>& b) {
+        if (a.size() != b.size()) return false;
+        for (std::size_t i = 0; i < a.size(); i++) {
+            if (a[i].first != b[i].first || a[i].second != b[i].second) return false;
+        }
+        return true;
+    }
+
+    struct Result {
+        double bruteMicros;
+        double gridMicros;
+        std::size_t contacts;
+        bool consistent;
+    };
+
+    Result measure(std::size_t count, int frames) {
+        Scene scene(count);
+        CollisionSystem collisionSystem;
+        collisionSystem.reserve(count);
+
+        std::vector<CollisionSystem::Contact> gridContacts;
+        std::vector<CollisionSystem::Contact> bruteContacts;
+        gridContacts.reserve(count);
+        bruteContacts.reserve(count);
+
+        Result result = { 0.0, 0.0, 0, true };
+        for (int frame = 0; frame < frames; frame++) {
+            scene.step(frame);
+
+            auto start = std::chrono::steady_clock::now();
+            bruteForceContacts(scene.registry, bruteContacts);
+            auto middle = std::chrono::steady_clock::now();
+            collisionSystem.update(scene.registry);
+            collisionSystem.findContacts(scene.registry, CollisionLayer::Bullet, CollisionLayer::Obstacle, gridContacts);
+            auto end = std::chrono::steady_clock::now();
+
+            result.bruteMicros += std::chrono::duration<double, std::micro>(middle - start).count();
+            result.gridMicros += std::chrono::duration<double, std::micro>(end - middle).count();
+            result.contacts += gridContacts.size();
+            result.consistent = result.consistent && sameContacts(gridContacts, bruteContacts);
+        }
+
+        result.bruteMicros /= frames;
+        result.gridMicros /= frames;
+        result.contacts /= frames;
+        return result;
+    }
+}
+
+int main() {
+    std::printf("cell size %.0f px, %.0f%% bullets, one entity per %.0fx%.0f px\n\n",
+                Config::SPATIAL_HASH_CELL_SIZE, BULLET_FRACTION * 100, SPACING, SPACING);
+    std::printf("%10s %14s %14s %9s %14s %10s\n",
+                "entities", "brute us/tick", "grid us/tick", "speedup", "contacts/tick", "identical");
+
+    bool consistent = true;
+    const std::size_t counts[] = { 1000, 10000 };
+    for (std::size_t count : counts) {
+        int frames = count <= 1000 ? 500 : 30;
+        Result result = measure(count, frames);
+        consistent = consistent && result.consistent;
+        std::printf("%10zu %14.1f %14.1f %8.1fx %14zu %10s\n", count, result.bruteMicros, result.gridMicros,
+                    result.bruteMicros / result.gridMicros, result.contacts, result.consistent ? "yes" : "NO");
+    }
+
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+// 粒子更新内核性能测试
+// 对比标量 / SSE2 / AVX2 实现的每秒粒子数，检查各实现结果是否一致，
+// 并报告每个粒子占用的内存
+#include "entities/ParticleKernel.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace {
+    // 每帧 tick 数（60 FPS）
+    const std::uint16_t FRAME_TICKS = 17;
+
+    // 填充随机粒子（生命周期足够长，测试期间不会死亡）
+    void fillParticles(ParticleStorage& particles, std::size_t count) {
+        std::mt19937 engine(12345);
+        std::uniform_real_distribution<float> position(0.0f, 800.0f);
+        std::uniform_real_distribution<float> velocity(-200.0f, 200.0f);
+        std::uniform_real_distribution<float> size(1.0f, 15.0f);
+        std::uniform_int_distribution<int> channel(0, 255);
+
+        particles.clear();
+        particles.resize(count);
+        for (std::size_t i = 0; i < count; i++) {
+            particles.positions[i] = sf::Vector2f(position(engine), position(engine));
+            particles.velocities[i] = ParticleStorage::packVelocity(sf::Vector2f(velocity(engine), velocity(engine)));
+            particles.colors[i] = sf::Color(channel(engine), channel(engine), channel(engine), channel(engine));
+            particles.sizes[i] = ParticleStorage::packSize(size(engine));
+            particles.lifetimes[i] = particles.maxLifetimes[i] = 60000;
+        }
+    }
+
+    // 原先每个粒子一个对象的布局（仅用于内存对比）
+    struct LegacyParticle {
+        sf::Vector2f position;
+        sf::Vector2f velocity;
+        sf::Color color;
+        sf::Color originalColor;
+        float size;
+        float originalSize;
+        float lifetime;
+        float maxLifetime;
+        float rotation;
+        float rotationSpeed;
+        enum class State { Active, Fading, Dead } state;
+        std::function<void(LegacyParticle&, float)> customUpdater;
+    };
+
+    // 量化之前的 SoA 布局：位置、速度、两个颜色、六个 float
+    const std::size_t FLOAT_SOA_BYTES = 2 * sizeof(sf::Vector2f) + 2 * sizeof(sf::Color) + 6 * sizeof(float);
+
+    void printMemoryReport() {
+        const std::size_t liveParticles = 3000;  // 默认粒子预算
+
+        struct Row {
+            const char* name;
+            std::size_t bytes;
+        };
+        const Row rows[] = {
+            { "object + std::function", sizeof(LegacyParticle) },
+            { "float SoA", FLOAT_SOA_BYTES },
+            { "quantized SoA", ParticleStorage::BYTES_PER_PARTICLE }
+        };
+
+        std::printf("%-24s %16s %16s %14s\n", "layout", "bytes/particle", "KiB @ 3000 live", "particles/64B");
+        for (const Row& row : rows) {
+            std::printf("%-24s %16zu %16.1f %14.2f\n", row.name, row.bytes,
+                        row.bytes * liveParticles / 1024.0, 64.0 / row.bytes);
+        }
+        std::printf("\n");
+    }
+
+    // 返回每秒处理的粒子数
+    double measure(ParticleKernel::Isa isa, std::size_t count, int frames) {
+        ParticleKernel::setIsa(isa);
+
+        ParticleStorage particles;
+        fillParticles(particles, count);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            ParticleKernel::integrate(particles, 1.0f / 60.0f, FRAME_TICKS);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        return static_cast<double>(count) * frames / seconds;
+    }
+
+    // 检查某个实现与标量实现逐位一致
+    bool matchesScalar(ParticleKernel::Isa isa, std::size_t count) {
+        ParticleStorage expected;
+        ParticleStorage actual;
+        fillParticles(expected, count);
+        fillParticles(actual, count);
+
+        // 让部分粒子进入淡出和死亡阶段
+        for (std::size_t i = 0; i < count; i += 3) {
+            expected.lifetimes[i] = actual.lifetimes[i] = static_cast<std::uint16_t>(10 * (i % 50));
+            expected.maxLifetimes[i] = actual.maxLifetimes[i] = 500;
+        }
+
+        // 完整更新和只更新生命周期两种路径都检查
+        ParticleKernel::setIsa(ParticleKernel::Isa::Scalar);
+        for (int frame = 0; frame < 30; frame++) ParticleKernel::integrate(expected, 1.0f / 60.0f, FRAME_TICKS);
+        for (int frame = 0; frame < 10; frame++) ParticleKernel::fade(expected, FRAME_TICKS);
+
+        ParticleKernel::setIsa(isa);
+        for (int frame = 0; frame < 30; frame++) ParticleKernel::integrate(actual, 1.0f / 60.0f, FRAME_TICKS);
+        for (int frame = 0; frame < 10; frame++) ParticleKernel::fade(actual, FRAME_TICKS);
+
+        return std::memcmp(expected.positions.data(), actual.positions.data(), count * sizeof(sf::Vector2f)) == 0 &&
+               std::memcmp(expected.lifetimes.data(), actual.lifetimes.data(), count * sizeof(std::uint16_t)) == 0;
+    }
+}
+
+int main() {
+    const ParticleKernel::Isa best = ParticleKernel::detectIsa();
+    std::printf("Detected ISA: %s\n\n", ParticleKernel::getIsaName(best));
+
+    printMemoryReport();
+
+    std::vector<ParticleKernel::Isa> isas = { ParticleKernel::Isa::Scalar };
+    if (static_cast<int>(best) >= static_cast<int>(ParticleKernel::Isa::SSE2)) isas.push_back(ParticleKernel::Isa::SSE2);
+    if (best == ParticleKernel::Isa::AVX2) isas.push_back(ParticleKernel::Isa::AVX2);
+
+    bool consistent = true;
+    for (ParticleKernel::Isa isa : isas) {
+        bool match = matchesScalar(isa, 1003);
+        consistent = consistent && match;
+        std::printf("%-7s matches scalar: %s\n", ParticleKernel::getIsaName(isa), match ? "yes" : "NO");
+    }
+    std::printf("\n%10s %8s %16s %8s\n", "particles", "ISA", "particles/sec", "speedup");
+
+    const std::size_t counts[] = { 1000, 10000, 100000 };
+    for (std::size_t count : counts) {
+        int frames = static_cast<int>(20000000 / count);
+        double scalarRate = 0.0;
+        for (ParticleKernel::Isa isa : isas) {
+            double rate = measure(isa, count, frames);
+            if (isa == ParticleKernel::Isa::Scalar) scalarRate = rate;
+            std::printf("%10zu %8s %16.0f %7.2fx\n", count, ParticleKernel::getIsaName(isa), rate, rate / scalarRate);
+        }
+    }
+
+    return consistent ? 0 : 1;
+}
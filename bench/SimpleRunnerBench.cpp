@@ -0,0 +1,269 @@
+// 热点路径微基准测试
+// 粒子发射和更新、多线程粒子池更新、障碍物生成、碰撞检测和分数文字重建，结果写成 JSON，
+// 可以与之前保存的结果对比找出变慢的测试。
+//   SimpleRunnerBench [--filter NAME] [--json FILE] [--baseline FILE] [--threshold PERCENT]
+#include "BenchHarness.h"
+#include "entities/ObstacleParticle.h"
+#include "entities/ParticleSystem.h"
+#include "systems/CollisionSystem.h"
+#include "systems/ParticlePool.h"
+#include "systems/ScoreSystem.h"
+#include "utils/AllocationCounter.h"
+#include "utils/ThreadPool.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+namespace {
+    const float TICK = Config::SIMULATION_TICK_TIME;
+
+    // 粒子寿命足够长，测试期间不会死亡
+    ParticleSystem::EmitterConfig longLivedEmitter(int maxParticles) {
+        ParticleSystem::EmitterConfig config;
+        config.position = sf::Vector2f(400.0f, 300.0f);
+        config.positionVariance = sf::Vector2f(200.0f, 200.0f);
+        config.minLifetime = 50.0f;
+        config.maxLifetime = 60.0f;
+        config.maxParticles = maxParticles;
+        config.continuous = false;
+        return config;
+    }
+
+    void addParticleBenchmarks(Bench::Runner& runner) {
+        // 碰撞爆发大小和一次大爆发
+        const int burstCounts[] = { 50, 1000 };
+        for (int count : burstCounts) {
+            runner.add("ParticleSystem::burst/" + std::to_string(count), count, [count](Bench::State& state) {
+                ParticleSystem system;
+                system.setEmitter(longLivedEmitter(count));
+
+                for (std::size_t i = 0; i < state.iterations; i++) {
+                    state.pause();
+                    system.clear();
+                    state.resume();
+
+                    system.burst(count);
+                }
+                Bench::doNotOptimize(system.getActiveParticleCount());
+            });
+        }
+
+        const int updateCounts[] = { 100, 1000, 100000 };
+        for (int count : updateCounts) {
+            runner.add("ParticleSystem::update/" + std::to_string(count), count, [count](Bench::State& state) {
+                ParticleSystem system;
+                system.setEmitter(longLivedEmitter(count));
+                system.burst(count);
+
+                for (std::size_t i = 0; i < state.iterations; i++) {
+                    system.update(TICK);
+
+                    // 粒子寿命到期后补满，保持粒子数不变
+                    if (system.getActiveParticleCount() < count) {
+                        state.pause();
+                        system.clear();
+                        system.burst(count);
+                        state.resume();
+                    }
+                }
+                Bench::doNotOptimize(system.getBounds());
+            });
+        }
+
+        // 粒子数超过多线程阈值的粒子池更新（与模拟相同的线程池和任务切分）。
+        // 性能测试构建统计分配：每次更新的分配超过预算时终止，与模拟更新的检查一致
+        const int systemCount = 64;
+        const int particlesPerSystem = 50;
+        const int poolParticles = systemCount * particlesPerSystem;
+        static_assert(systemCount * particlesPerSystem >= Config::PARTICLE_PARALLEL_MIN_PARTICLES,
+                      "parallel pool benchmark must reach the parallel update threshold");
+        runner.add("ParticlePool::update/parallel/" + std::to_string(poolParticles), poolParticles,
+                   [](Bench::State& state) {
+            // 固定工作线程数：单核机器上也经过任务队列和窃取
+            ThreadPool threadPool(3, (Config::PARTICLE_POOL_SYSTEMS + Config::PARTICLE_PARALLEL_GRAIN - 1) /
+                                         Config::PARTICLE_PARALLEL_GRAIN);
+            ParticlePool particlePool;
+            particlePool.setBudget(poolParticles * 2);
+
+            std::vector<ParticleHandle> handles;
+            for (int i = 0; i < systemCount; i++) {
+                ParticleHandle handle = particlePool.acquire(ParticleRenderer::Layer::Over, ParticlePriority::Trail);
+                particlePool.get(handle)->setEmitter(longLivedEmitter(particlesPerSystem));
+                handles.push_back(handle);
+            }
+            auto refill = [&particlePool, &handles]() {
+                for (const ParticleHandle& handle : handles) {
+                    particlePool.get(handle)->clear();
+                    particlePool.burst(handle, particlesPerSystem);
+                }
+            };
+            refill();
+
+            for (std::size_t i = 0; i < state.iterations; i++) {
+                // 粒子寿命到期后补满，保持在多线程阈值之上
+                if (particlePool.getActiveParticleCount() < Config::PARTICLE_PARALLEL_MIN_PARTICLES) {
+                    state.pause();
+                    refill();
+                    state.resume();
+                }
+
+                std::uint64_t allocationsBefore = AllocationCounter::getThreadAllocationCount();
+                particlePool.update(TICK, threadPool);
+                std::uint64_t allocations = AllocationCounter::getThreadAllocationCount() - allocationsBefore;
+                if (allocations > static_cast<std::uint64_t>(Config::ALLOCATION_BUDGET_PER_TICK)) {
+                    std::fprintf(stderr, "Allocation budget exceeded: %llu allocation(s) in one parallel pool update (budget %d)\n",
+                                 static_cast<unsigned long long>(allocations), Config::ALLOCATION_BUDGET_PER_TICK);
+                    std::abort();
+                }
+            }
+            Bench::doNotOptimize(particlePool.getActiveParticleCount());
+        });
+    }
+
+    void addObstacleBenchmarks(Bench::Runner& runner) {
+        // 创建障碍物实体：组件、借用并启动拖尾和光环粒子系统
+        runner.add("ObstacleParticle::spawn", 1, [](Bench::State& state) {
+            EntityRegistry registry;
+            ParticlePool particlePool;
+            ObstacleParticle obstacles(registry, particlePool);
+
+            for (std::size_t i = 0; i < state.iterations; i++) {
+                if (obstacles.getCount() >= static_cast<std::size_t>(Config::OBSTACLE_POOL_CAPACITY)) {
+                    state.pause();
+                    particlePool.clear();
+                    registry.clear();
+                    state.resume();
+                }
+
+                auto type = static_cast<ObstacleParticle::Type>(i % ObstacleParticle::TYPE_COUNT);
+                Bench::doNotOptimize(obstacles.spawn(100.0f + (i % 600), -50.0f, 200.0f, type));
+            }
+        });
+    }
+
+    // 随机分布的子弹和障碍物，平均每个实体占 100x100 像素
+    struct CollisionScene {
+        EntityRegistry registry;
+        CollisionSystem collisionSystem;
+        std::vector<CollisionSystem::Contact> contacts;
+        float worldSize;
+
+        explicit CollisionScene(std::size_t count) : registry(count) {
+            worldSize = std::sqrt(static_cast<float>(count)) * 100.0f;
+            collisionSystem.reserve(count);
+            contacts.reserve(count);
+
+            std::mt19937 engine(12345);
+            std::uniform_real_distribution<float> position(0.0f, worldSize);
+            std::size_t bulletCount = count / 5;
+
+            for (std::size_t i = 0; i < count; i++) {
+                bool bullet = i < bulletCount;
+                Entity entity = registry.create();
+                registry.transforms.add(entity, Transform(sf::Vector2f(position(engine), position(engine))));
+
+                Collider collider;
+                float extent = bullet ? 8.0f : 20.0f;
+                collider.halfSize = sf::Vector2f(extent, extent);
+                collider.layer = bullet ? CollisionLayer::Bullet : CollisionLayer::Obstacle;
+                registry.colliders.add(entity, collider);
+            }
+        }
+    };
+
+    void addCollisionBenchmarks(Bench::Runner& runner) {
+        const std::size_t counts[] = { 100, 1000, 10000 };
+        for (std::size_t count : counts) {
+            // 子弹与障碍物（Simulation::checkBulletCollisions 的检测部分，含每帧重建网格）
+            runner.add("CollisionSystem::bulletContacts/" + std::to_string(count), count,
+                       [count](Bench::State& state) {
+                CollisionScene scene(count);
+                for (std::size_t i = 0; i < state.iterations; i++) {
+                    scene.collisionSystem.update(scene.registry);
+                    scene.collisionSystem.findContacts(scene.registry, CollisionLayer::Bullet,
+                                                       CollisionLayer::Obstacle, scene.contacts);
+                    Bench::doNotOptimize(scene.contacts.size());
+                }
+            });
+
+            // 玩家与障碍物（Simulation::checkCollisions 的检测部分，网格已建好）
+            runner.add("CollisionSystem::playerOverlap/" + std::to_string(count), 1,
+                       [count](Bench::State& state) {
+                CollisionScene scene(count);
+                scene.collisionSystem.update(scene.registry);
+                for (std::size_t i = 0; i < state.iterations; i++) {
+                    float x = static_cast<float>(i % 997) / 997.0f * scene.worldSize;
+                    sf::FloatRect player(x, scene.worldSize / 2.0f, Config::PLAYER_WIDTH, Config::PLAYER_HEIGHT);
+                    Bench::doNotOptimize(scene.collisionSystem.findFirstOverlap(scene.registry, player,
+                                                                                CollisionLayer::Obstacle));
+                }
+            });
+        }
+    }
+
+    void addScoreBenchmarks(Bench::Runner& runner) {
+        runner.add("ScoreSystem::updateText", 1, [](Bench::State& state) {
+            ScoreSystem scoreSystem;
+            for (std::size_t i = 0; i < state.iterations; i++) {
+                scoreSystem.addScore(1);
+                scoreSystem.updateText();
+            }
+            Bench::doNotOptimize(scoreSystem.getScore());
+        });
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::string filter;
+    std::string jsonPath = "SimpleRunnerBench.json";
+    std::string baselinePath;
+    double threshold = 10.0;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--filter") == 0 && hasValue) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--json") == 0 && hasValue) {
+            jsonPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--baseline") == 0 && hasValue) {
+            baselinePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--threshold") == 0 && hasValue) {
+            threshold = std::atof(argv[++i]);
+        } else {
+            std::fprintf(stderr, "Usage: %s [--filter NAME] [--json FILE] [--baseline FILE] [--threshold PERCENT]\n",
+                         argv[0]);
+            return 1;
+        }
+    }
+
+    // 固定种子，每次运行的粒子和障碍物参数相同
+    RandomService::getInstance().seed(12345);
+
+    Bench::Runner runner;
+    addParticleBenchmarks(runner);
+    addObstacleBenchmarks(runner);
+    addCollisionBenchmarks(runner);
+    addScoreBenchmarks(runner);
+
+    std::vector<Bench::Result> results = runner.run(filter);
+    if (!Bench::writeJson(jsonPath, "SimpleRunnerBench", results)) {
+        return 1;
+    }
+    std::printf("\nResults written to %s\n", jsonPath.c_str());
+
+    if (!baselinePath.empty()) {
+        std::vector<Bench::Result> baseline;
+        if (!Bench::readJson(baselinePath, baseline)) {
+            return 1;
+        }
+        int regressions = Bench::compare(baseline, results, threshold / 100.0);
+        if (regressions > 0) {
+            std::printf("\n%d benchmark(s) slower than baseline by more than %.0f%%\n", regressions, threshold);
+            return 2;
+        }
+    }
+
+    return 0;
+}
@@ -13,6 +13,11 @@ namespace Config {
     const float GRAVITY = 500.0f;
     const float PLAYER_SPEED = 300.0f;  // 玩家的移动速度（水平和垂直相同）
     
+    // 模拟设置（固定步长，与显示帧率无关）
+    const float SIMULATION_TICK_RATE = 120.0f;                       // 每秒模拟次数
+    const float SIMULATION_TICK_TIME = 1.0f / SIMULATION_TICK_RATE;  // 每次模拟的时间步长
+    const int SIMULATION_MAX_TICKS_PER_FRAME = 10;  // 每帧最多补几次模拟，超出的时间直接丢弃（游戏变慢而不是卡死）
+    
     // 颜色定义
     const sf::Color BACKGROUND_COLOR = sf::Color(30, 30, 46);
     const sf::Color PLAYER_COLOR = sf::Color(88, 199, 250);
@@ -35,6 +40,64 @@ namespace Config {
     const float PARTICLE_OBSTACLE_RADIUS = 20.0f;
     const float PARTICLE_OBSTACLE_SPAWN_TIME = 1.2f;
     
+    // 实体池设置（游戏开始时一次性分配，达到上限后不再生成）
+    const int OBSTACLE_POOL_CAPACITY = 64;  // 同时存在的障碍物上限
+    const int BULLET_POOL_CAPACITY = 32;    // 同时存在的子弹上限（含击中后淡出的子弹）
+    
+    // 碰撞检测设置
+    const float SPATIAL_HASH_CELL_SIZE = 64.0f;  // 空间哈希格子边长（不小于最大的碰撞盒）
+    
+    // 粒子池设置
+    const int PARTICLE_POOL_SYSTEMS = 256;          // 粒子系统总数
+    const int PARTICLE_POOL_SYSTEM_CAPACITY = 200;  // 每个系统预分配的粒子数
+    
+    // 多线程粒子更新设置
+    const int PARTICLE_PARALLEL_MIN_PARTICLES = 2000;  // 粒子总数超过该值才使用多线程
+    const int PARTICLE_PARALLEL_GRAIN = 4;             // 每个任务包含的粒子系统数
+    
+    // 全局粒子预算设置
+    const int PARTICLE_BUDGET = 3000;                   // 同屏粒子总数上限
+    const float PARTICLE_AURA_THROTTLE_START = 0.5f;    // 粒子数达到预算的该比例时光环开始减少发射
+    const float PARTICLE_TRAIL_THROTTLE_START = 0.75f;  // 拖尾开始减少发射的比例
+    
+    // 视锥剔除设置
+    const float PARTICLE_CULL_MARGIN = 8.0f;           // 可见区域向外扩展的距离
+    const int PARTICLE_OFFSCREEN_UPDATE_INTERVAL = 4;  // 不可见的粒子系统每隔几帧更新一次
+    
+    // 自适应画质设置
+    const float QUALITY_TARGET_FRAME_TIME = 1.0f / 60.0f;  // 目标帧时间
+    const float QUALITY_DOWNGRADE_RATIO = 1.15f;  // 平均帧间隔超过目标的该倍数时降级
+    const float QUALITY_UPGRADE_RATIO = 0.6f;     // 平均工作时间低于目标的该倍数时升级
+    const float QUALITY_DOWNGRADE_HOLD = 0.5f;    // 持续超时多少秒后降级
+    const float QUALITY_UPGRADE_HOLD = 3.0f;      // 持续空闲多少秒后升级
+    const float QUALITY_MAX_UPGRADE_HOLD = 60.0f; // 升级等待时间的上限
+    const float QUALITY_CHANGE_COOLDOWN = 1.0f;   // 切换后的冷却时间
+    const float QUALITY_UPGRADE_PROBATION = 10.0f; // 升级后该时间内又降级视为升级失败
+    const float QUALITY_SMOOTHING = 0.1f;         // 帧时间指数平滑系数
+    const float QUALITY_MAX_SAMPLE = 0.25f;       // 超过该值的帧（拖动窗口等）不参与统计
+    
+    // 性能覆盖层设置（F3 切换）
+    const sf::Keyboard::Key PROFILER_TOGGLE_KEY = sf::Keyboard::F3;
+    const float PROFILER_GRAPH_MAX_TIME = 2.0f / 60.0f;  // 帧时间曲线顶端对应的帧时间（超出的截断）
+    const float PROFILER_GRAPH_HEIGHT = 60.0f;           // 曲线区域高度（像素）
+    
+    // 时间线记录设置（F4 开始/停止并写出）
+    const sf::Keyboard::Key TRACE_TOGGLE_KEY = sf::Keyboard::F4;
+    const int TRACE_MAX_EVENTS_PER_THREAD = 1 << 18;     // 每个线程的事件缓冲区大小（每个事件 24 字节）
+    const std::string TRACE_FILE_PREFIX = "simplerunner_trace";  // 写出 simplerunner_trace_1.json、_2.json ...
+    
+    // 性能报告（游戏结束和退出时写出）
+    const std::string REPORT_JSON_PATH = "simplerunner_report.json";  // 每次覆盖
+    const std::string REPORT_CSV_PATH = "simplerunner_report.csv";    // 每次追加一行
+    
+    // 分配预算：Debug 和性能测试构建中，游戏进行时每一步模拟更新允许的堆分配次数
+    const int ALLOCATION_BUDGET_PER_TICK = 0;
+    
+    // 日志设置
+    const int LOG_QUEUE_CAPACITY = 512;    // 等待写出的消息上限（必须是2的幂），超出时丢弃
+    const int LOG_MESSAGE_SIZE = 160;      // 单条消息的最大长度（含结尾的 0）
+    const int LOG_FLUSH_INTERVAL_MS = 10;  // 队列为空时后台线程的检查间隔
+    
     // 速度增长设置
     const float SPEED_INCREASE_INTERVAL = 10.0f;  // 每10秒增加一次速度
     const float SPEED_INCREASE_AMOUNT = 20.0f;    // 每次增加20速度单位
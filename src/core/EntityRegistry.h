@@ -0,0 +1,200 @@
+#ifndef ENTITY_REGISTRY_H
+#define ENTITY_REGISTRY_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "Config.h"
+#include "../entities/Components.h"
+
+// 实体句柄（下标 + 代数，实体销毁后旧句柄自动失效）
+struct Entity {
+    static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    std::uint32_t index = INVALID_INDEX;
+    std::uint32_t generation = 0;
+
+    bool isValid() const { return index != INVALID_INDEX; }
+
+    bool operator==(const Entity& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+// 稀疏集合：按实体下标查找（稀疏数组），按插入顺序连续存放（密集数组）
+// 系统直接顺序遍历 data()/entities()，删除使用交换删除，O(1)。
+// 遍历过程中不要增删同一个数组的元素，需要销毁的实体先收集起来再处理。
+template <typename T>
+class ComponentArray {
+public:
+    static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+    bool has(Entity entity) const {
+        return entity.index < sparse.size() && sparse[entity.index] != NONE &&
+               owners[sparse[entity.index]] == entity;
+    }
+
+    // 添加或覆盖组件
+    T& add(Entity entity, const T& component) {
+        if (entity.index >= sparse.size()) {
+            sparse.resize(entity.index + 1, NONE);
+        }
+
+        std::uint32_t slot = sparse[entity.index];
+        if (slot != NONE) {
+            owners[slot] = entity;
+            components[slot] = component;
+            return components[slot];
+        }
+
+        sparse[entity.index] = static_cast<std::uint32_t>(components.size());
+        owners.push_back(entity);
+        components.push_back(component);
+        return components.back();
+    }
+
+    void remove(Entity entity) {
+        if (!has(entity)) return;
+
+        std::uint32_t slot = sparse[entity.index];
+        std::uint32_t last = static_cast<std::uint32_t>(components.size() - 1);
+        if (slot != last) {
+            owners[slot] = owners[last];
+            components[slot] = components[last];
+            sparse[owners[slot].index] = slot;
+        }
+        owners.pop_back();
+        components.pop_back();
+        sparse[entity.index] = NONE;
+    }
+
+    // 实体没有该组件时返回空指针
+    T* find(Entity entity) { return has(entity) ? &components[sparse[entity.index]] : nullptr; }
+    const T* find(Entity entity) const { return has(entity) ? &components[sparse[entity.index]] : nullptr; }
+
+    // 调用者需保证组件存在
+    T& get(Entity entity) { return components[sparse[entity.index]]; }
+    const T& get(Entity entity) const { return components[sparse[entity.index]]; }
+
+    std::size_t size() const { return components.size(); }
+    bool empty() const { return components.empty(); }
+
+    // 密集数组，下标 i 的组件属于 entities()[i]
+    T* data() { return components.data(); }
+    const T* data() const { return components.data(); }
+    const Entity* entities() const { return owners.data(); }
+
+    void reserve(std::size_t count) {
+        sparse.reserve(count);
+        owners.reserve(count);
+        components.reserve(count);
+    }
+
+    void clear() {
+        sparse.clear();
+        owners.clear();
+        components.clear();
+    }
+
+private:
+    std::vector<std::uint32_t> sparse;  // 实体下标 -> 密集数组下标
+    std::vector<Entity> owners;         // 密集数组下标 -> 实体
+    std::vector<T> components;
+};
+
+// 实体注册表
+// 实体本身只是一个句柄，数据全部保存在各组件的密集数组中；
+// 移动、剔除、碰撞等系统逐个数组线性遍历，不再经过每个对象的堆指针。
+// 容量固定：构造时为所有数组预留内存，实体下标和组件槽位原地复用，
+// 达到上限后 create() 返回无效实体，运行过程中不再分配内存。
+class EntityRegistry {
+public:
+    explicit EntityRegistry(std::size_t capacity = Config::OBSTACLE_POOL_CAPACITY +
+                                                   Config::BULLET_POOL_CAPACITY)
+        : capacity(capacity) {
+        generations.reserve(capacity);
+        freeIndices.reserve(capacity);
+
+        transforms.reserve(capacity);
+        velocities.reserve(capacity);
+        colliders.reserve(capacity);
+        emitters.reserve(capacity);
+        lifetimes.reserve(capacity);
+        renders.reserve(capacity);
+    }
+
+    // 注册表已满时返回无效实体
+    Entity create() {
+        Entity entity;
+        if (aliveCount >= capacity) return entity;
+
+        if (!freeIndices.empty()) {
+            entity.index = freeIndices.back();
+            freeIndices.pop_back();
+        } else {
+            entity.index = static_cast<std::uint32_t>(generations.size());
+            generations.push_back(0);
+        }
+        entity.generation = generations[entity.index];
+        aliveCount++;
+        return entity;
+    }
+
+    // 删除实体的所有组件，句柄失效
+    void destroy(Entity entity) {
+        if (!isAlive(entity)) return;
+
+        transforms.remove(entity);
+        velocities.remove(entity);
+        colliders.remove(entity);
+        emitters.remove(entity);
+        lifetimes.remove(entity);
+        renders.remove(entity);
+
+        generations[entity.index]++;
+        freeIndices.push_back(entity.index);
+        aliveCount--;
+    }
+
+    bool isAlive(Entity entity) const {
+        return entity.isValid() && entity.index < generations.size() &&
+               generations[entity.index] == entity.generation;
+    }
+
+    // 销毁所有实体（保留已分配的内存）
+    void clear() {
+        freeIndices.clear();
+        for (std::uint32_t index = 0; index < generations.size(); index++) {
+            generations[index]++;
+            freeIndices.push_back(index);
+        }
+        aliveCount = 0;
+
+        transforms.clear();
+        velocities.clear();
+        colliders.clear();
+        emitters.clear();
+        lifetimes.clear();
+        renders.clear();
+    }
+
+    std::size_t getAliveCount() const { return aliveCount; }
+    std::size_t getCapacity() const { return capacity; }
+
+    // 组件数组
+    ComponentArray<Transform> transforms;
+    ComponentArray<Velocity> velocities;
+    ComponentArray<Collider> colliders;
+    ComponentArray<Emitter> emitters;
+    ComponentArray<Lifetime> lifetimes;
+    ComponentArray<Render> renders;
+
+private:
+    std::size_t capacity;
+    std::vector<std::uint32_t> generations;
+    std::vector<std::uint32_t> freeIndices;
+    std::size_t aliveCount = 0;
+};
+
+#endif
@@ -1,25 +1,40 @@
 #include "Game.h"
-#include "../entities/Bullet.h"  // 添加这行，包含Bullet类的定义
 #include <iostream>
-#include <random>
 #include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <iomanip>
 
 Game::Game() 
     : window(sf::VideoMode(Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT), 
              Config::WINDOW_TITLE),
-      currentState(GameState::StartScreen),
-      obstacleSpawnTimer(0.0f),
-      speedIncreaseTimer(0.0f),
-      currentObstacleSpeedMin(Config::OBSTACLE_SPEED_MIN),
-      currentObstacleSpeedMax(Config::OBSTACLE_SPEED_MAX),
-      speedLevel(0),
-      showInstructions(true),
-      blinkTimer(0.0f) {
+      qualityLevel(0),
+      simulationRunning(false),
+      frameWorkTime(0.0f),
+      showProfiler(false),
+      drawCalls(0),
+      lastDrawCalls(0),
+      fpsFrameCount(0),
+      fps(0.0f),
+      traceCount(0),
+      lastState(GameState::StartScreen),
+      interpolation(1.0f),
+      startScreenLayer(sf::FloatRect(0, 0, Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT)),
+      instructionsLayer(sf::FloatRect(0, 0, Config::WINDOW_WIDTH, 200)),  // 文字会超出背景框，取整个宽度
+      gameOverLayer(sf::FloatRect(0, 0, Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT)),
+      finalScore(-1),
+      finalLevel(-1) {
     
     window.setFramerateLimit(60);
     
+    // 线程启动前完成初始设置：画质、可见区域、快照容量
+    qualityLevel.store(static_cast<int>(qualityController.getLevel()));
+    simulation.applyQualitySettings(qualityController.getSettings());
+    simulation.setViewBounds(getViewBounds());
+    snapshots.forEach([this](RenderSnapshot& snapshot) {
+        snapshot.entities.reserve(simulation.getEntityCapacity());
+    });
+    
     // 尝试多个字体路径
     if (!font.loadFromFile("assets/fonts/arial.ttf")) {
         if (!font.loadFromFile("../assets/fonts/arial.ttf")) {
@@ -35,7 +50,8 @@ Game::Game()
         }
     }
     
-    scoreSystem.setFont(font);
+    scoreDisplay.setFont(font);
+    profilerOverlay.setFont(font);
     
     pressAnyKeyText.setFont(font);
     pressAnyKeyText.setString("Press any key to start...");
@@ -45,218 +61,312 @@ Game::Game()
     pressAnyKeyText.setOrigin(textRect.left + textRect.width / 2.0f,
                              textRect.top + textRect.height / 2.0f);
     pressAnyKeyText.setPosition(Config::WINDOW_WIDTH / 2.0f,
-                               Config::WINDOW_HEIGHT - 80);
+                               Config::WINDOW_HEIGHT - 100);
+    
+    finalScoreText.setFont(font);
+    finalScoreText.setCharacterSize(32);
+    finalScoreText.setFillColor(sf::Color::White);
+    
+    finalLevelText.setFont(font);
+    finalLevelText.setCharacterSize(24);
+    finalLevelText.setFillColor(sf::Color::Yellow);
     
-    std::cout << "===========================================" << std::endl;
-    std::cout << "Simple Runner with Particle Obstacles" << std::endl;
-    std::cout << "===========================================" << std::endl;
-    std::cout << "Waiting for player to start game..." << std::endl;
+    LOG_INFO(LogCategory::Game, "Simple Runner with Particle Obstacles: waiting for player to start game...");
+}
+
+Game::~Game() {
+    stopSimulation();
 }
 
 void Game::run() {
-    sf::Clock clock;
+    startSimulation();
+    frameClock.restart();
     
     while (window.isOpen()) {
-        float deltaTime = clock.restart().asSeconds();
+        float frameTime = frameClock.restart().asSeconds();
+        performanceReport.recordFrame(frameTime);
+        renderProfiler.beginFrame();
         
-        processEvents();
-        update(deltaTime);
-        render();
-    }
-}
-
-void Game::processEvents() {
-    sf::Event event;
-    while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed) {
-            window.close();
+        {
+            PROFILE_SCOPE(renderProfiler, "processEvents");
+            processEvents();
         }
         
-        if (currentState == GameState::StartScreen) {
-            if (event.type == sf::Event::KeyPressed) {
-                startGame();
-                std::cout << "Game started!" << std::endl;
-            }
+        // 取最新发布的快照（没有新快照时继续使用上一个）
+        snapshots.acquire();
+        const RenderSnapshot& snapshot = snapshots.getReadBuffer();
+        if (snapshot.quitRequested) {
+            window.close();
         }
-        else if (currentState == GameState::Playing || currentState == GameState::GameOver) {
-            if (event.type == sf::Event::KeyPressed) {
-                // 重新开始游戏 (仅限游戏结束状态)
-                if (event.key.code == sf::Keyboard::R && currentState == GameState::GameOver) {
-                    currentState = GameState::Playing;
-                    player.reset();
-                    obstacles.clear();
-                    scoreSystem.reset();
-                    obstacleSpawnTimer = 0.0f;
-                    resetDifficulty();
-                    std::cout << "Game restarted!" << std::endl;
-                    std::cout << "Speed reset to level 0" << std::endl;
-                }
-                
-                // 退出游戏
-                if (event.key.code == sf::Keyboard::Escape) {
-                    window.close();
-                }
-                
-                // 切换说明显示（游戏中）
-                if (event.key.code == sf::Keyboard::H && currentState == GameState::Playing) {
-                    showInstructions = !showInstructions;
-                    std::cout << "Instructions " << (showInstructions ? "shown" : "hidden") << std::endl;
-                }
-                
-                // 返回菜单（游戏中或游戏结束都可以）
-                if (event.key.code == sf::Keyboard::M && 
-                   (currentState == GameState::Playing || currentState == GameState::GameOver)) {
-                    currentState = GameState::StartScreen;
-                    player.reset();
-                    obstacles.clear();
-                    scoreSystem.reset();
-                    obstacleSpawnTimer = 0.0f;
-                    resetDifficulty();
-                    blinkTimer = 0.0f; // 重置闪烁计时器
-                    std::cout << "Returned to start screen" << std::endl;
-                }
-            }
+        
+        if (snapshot.state == GameState::Playing) {
+            performanceReport.recordLoad(snapshot.speedLevel, snapshot.obstacleCount, snapshot.activeParticles);
         }
-    }
-}
-
-void Game::update(float deltaTime) {
-    if (currentState == GameState::StartScreen) {
-        blinkTimer += deltaTime;
-        if (blinkTimer >= 1.0f) {
-            blinkTimer = 0.0f;
+        if (snapshot.state == GameState::GameOver && lastState != GameState::GameOver) {
+            writeReport("game_over");
         }
-        return;
-    }
-    
-    if (currentState != GameState::Playing) {
-        return;
+        lastState = snapshot.state;
+        
+        // 绘制时刻相对快照的位置：发布时剩余的模拟时间加上发布以来经过的时间
+        float sinceUpdate = snapshot.pendingTime + timeline.getElapsedTime().asSeconds() - snapshot.publishTime;
+        interpolation = std::min(std::max(sinceUpdate / Config::SIMULATION_TICK_TIME, 0.0f), 1.0f);
+        
+        render(snapshot);
+        
+        updateQuality(frameTime);
+        renderProfiler.endFrame();
     }
     
-    player.update(deltaTime);
+    stopSimulation();
+    writeReport("exit");
     
-    for (auto& obstacle : obstacles) {
-        obstacle->update(deltaTime);
+    // 退出时写出还在进行的记录
+    if (Tracer::isEnabled()) {
+        toggleTrace();
     }
-    
-    // 移除离开屏幕或应该被移除的障碍物
-    obstacles.erase(
-        std::remove_if(obstacles.begin(), obstacles.end(),
-            [](const std::unique_ptr<ObstacleParticle>& o) {
-                return o->isOffScreen() || o->shouldRemove();
-            }),
-        obstacles.end()
-    );
-    
-    obstacleSpawnTimer += deltaTime;
-    if (obstacleSpawnTimer >= Config::PARTICLE_OBSTACLE_SPAWN_TIME) {
-        spawnObstacle();
-        obstacleSpawnTimer = 0.0f;
+}
+
+void Game::startSimulation() {
+    simulationRunning.store(true);
+    simulationThread = std::thread(&Game::simulationLoop, this);
+}
+
+void Game::stopSimulation() {
+    simulationRunning.store(false);
+    if (simulationThread.joinable()) {
+        simulationThread.join();
     }
+}
+
+void Game::simulationLoop() {
+    Tracer::setThreadName("simulation");
     
-    scoreSystem.update(deltaTime);
-    updateDifficulty(deltaTime);
-    
-    // 检测子弹与障碍物的碰撞
-    checkBulletCollisions();
+    sf::Clock clock;
+    float accumulator = 0.0f;
+    int appliedQuality = qualityLevel.load();
+    Profiler& profiler = simulation.getProfiler();
     
-    // 检测玩家与障碍物的碰撞
-    if (checkCollisions()) {
-        currentState = GameState::GameOver;
-        std::cout << "Game Over! Final score: " << scoreSystem.getScore() << std::endl;
-        std::cout << "Final speed level: " << speedLevel << std::endl;
+    while (simulationRunning.load(std::memory_order_relaxed)) {
+        float frameTime = clock.restart().asSeconds();
+        profiler.beginFrame();
+        
+        // 渲染线程调整了画质
+        int requestedQuality = qualityLevel.load(std::memory_order_relaxed);
+        if (requestedQuality != appliedQuality) {
+            simulation.applyQualitySettings(
+                QualityController::getSettings(static_cast<QualityLevel>(requestedQuality)));
+            appliedQuality = requestedQuality;
+        }
+        
+        // 处理渲染线程转发的输入
+        bool changed = false;
+        {
+            PROFILE_SCOPE(profiler, "input");
+            sf::Event event;
+            while (inputQueue.pop(event)) {
+                simulation.handleEvent(event);
+                changed = true;
+            }
+        }
+        
+        // 模拟总是以固定步长推进：慢帧不会让高速子弹一步越过障碍物，结果也可以重现
+        accumulator += frameTime;
+        
+        int ticks = 0;
+        while (accumulator >= Config::SIMULATION_TICK_TIME &&
+               ticks < Config::SIMULATION_MAX_TICKS_PER_FRAME) {
+            simulation.update(Config::SIMULATION_TICK_TIME);
+            accumulator -= Config::SIMULATION_TICK_TIME;
+            ticks++;
+        }
+        
+        // 追赶次数达到上限（长时间卡顿）：丢弃积压的时间，避免越追越慢
+        if (accumulator >= Config::SIMULATION_TICK_TIME) {
+            accumulator = std::fmod(accumulator, Config::SIMULATION_TICK_TIME);
+        }
+        
+        // 发布新的快照，渲染线程从中取得最新状态
+        if (ticks > 0 || changed) {
+            RenderSnapshot& snapshot = snapshots.getWriteBuffer();
+            simulation.writeSnapshot(snapshot);
+            snapshot.publishTime = timeline.getElapsedTime().asSeconds();
+            snapshot.pendingTime = accumulator;
+            snapshots.publish();
+        }
+        
+        // 等待的时间不计入模拟线程的帧时间
+        profiler.endFrame();
+        
+        // 等到下一步的时间再继续
+        sf::sleep(sf::seconds(Config::SIMULATION_TICK_TIME - accumulator));
     }
 }
 
-// 修改碰撞检测函数
-bool Game::checkCollisions() {
-    for (const auto& obstacle : obstacles) {
-        if (player.getBounds().intersects(obstacle->getBounds())) {
-            // 触发碰撞效果
-            obstacle->triggerCollisionEffect();
-            // 注意：这里不再调用 triggerDestroyEffect()，而是直接标记为可移除
-            // 障碍物会播放粒子效果后自然消失
-            
-            std::cout << "Collision with obstacle type: ";
-            switch (obstacle->getType()) {
-                case ObstacleParticle::Type::Fire: std::cout << "Fire"; break;
-                case ObstacleParticle::Type::Ice: std::cout << "Ice"; break;
-                case ObstacleParticle::Type::Electric: std::cout << "Electric"; break;
-                case ObstacleParticle::Type::Poison: std::cout << "Poison"; break;
-                default: std::cout << "Unknown"; break;
-            }
-            std::cout << " at speed level " << speedLevel << std::endl;
-            
-            return true;
-        }
+void Game::toggleTrace() {
+    if (!Tracer::isEnabled()) {
+        Tracer::start();
+        LOG_INFO(LogCategory::Render, "Trace started");
+        return;
     }
-    return false;
+    
+    traceCount++;
+    Tracer::stop(Config::TRACE_FILE_PREFIX + "_" + std::to_string(traceCount) + ".json");
 }
 
-// 修改子弹碰撞检测函数
-void Game::checkBulletCollisions() {
-    for (auto& bullet : player.getBullets()) {
-        if (!bullet->isActive()) continue;
+void Game::writeReport(const char* reason) {
+    performanceReport.write(Config::REPORT_JSON_PATH, Config::REPORT_CSV_PATH, reason,
+                            QualityController::getLevelName(qualityController.getLevel()));
+}
+
+void Game::updateQuality(float frameTime) {
+    if (!qualityController.update(frameTime, frameWorkTime)) return;
+    
+    qualityLevel.store(static_cast<int>(qualityController.getLevel()), std::memory_order_relaxed);
+    LOG_INFO(LogCategory::Render, "Quality changed to %s",
+             QualityController::getLevelName(qualityController.getLevel()));
+}
+
+void Game::processEvents() {
+    sf::Event event;
+    while (window.pollEvent(event)) {
+        if (event.type == sf::Event::Closed) {
+            window.close();
+        }
         
-        for (auto& obstacle : obstacles) {
-            if (bullet->getBounds().intersects(obstacle->getBounds())) {
-                // 触发子弹的销毁效果
-                bullet->triggerDestroyEffect();
-                
-                // 障碍物立即销毁
-                obstacle->destroyImmediately();
-                
-                // 增加分数（击碎障碍物得50分）
-                scoreSystem.addScore(50);
-                
-                std::cout << "Obstacle destroyed! +50 points" << std::endl;
-                
-                break; // 一颗子弹只能击中一个障碍物
+        // 性能覆盖层和时间线记录只属于渲染线程，不转发给模拟
+        if (event.type == sf::Event::KeyPressed && event.key.code == Config::PROFILER_TOGGLE_KEY) {
+            showProfiler = !showProfiler;
+            continue;
+        }
+        if (event.type == sf::Event::KeyPressed && event.key.code == Config::TRACE_TOGGLE_KEY) {
+            toggleTrace();
+            continue;
+        }
+        
+        // 只转发模拟需要的事件；队列满时丢弃（模拟线程卡住时不阻塞窗口）
+        if (event.type == sf::Event::KeyPressed ||
+            event.type == sf::Event::KeyReleased ||
+            event.type == sf::Event::LostFocus) {
+            if (!inputQueue.push(event)) {
+                LOG_WARNING(LogCategory::Game, "Input queue full, event dropped");
             }
         }
     }
 }
 
-void Game::render() {
+void Game::render(const RenderSnapshot& snapshot) {
+    PROFILE_SCOPE(renderProfiler, "render");
+    
     window.clear(Config::BACKGROUND_COLOR);
+    drawCalls = 0;
+    
+    fpsFrameCount++;
+    if (fpsClock.getElapsedTime().asSeconds() >= 1.0f) {
+        fps = fpsFrameCount / fpsClock.restart().asSeconds();
+        fpsFrameCount = 0;
+    }
     
-    switch (currentState) {
-        case GameState::StartScreen:
-            drawStartScreen();
+    switch (snapshot.state) {
+        case GameState::StartScreen: {
+            PROFILE_SCOPE(renderProfiler, "startScreen");
+            drawStartScreen(snapshot);
             break;
+        }
             
         case GameState::Playing:
-            player.draw(window);
-            
-            for (auto& obstacle : obstacles) {
-                obstacle->draw(window);
+        case GameState::GameOver: {
+            {
+                PROFILE_SCOPE(renderProfiler, "player");
+                drawCalls += playerRenderer.draw(window, snapshot.player, interpolation);
             }
-            
-            drawUI();
-            drawDebugInfo();
-            
-            if (showInstructions) {
-                drawGameInstructions();
+            {
+                PROFILE_SCOPE(renderProfiler, "bullets");
+                drawCalls += entityRenderer.draw(window, snapshot.entities, getViewBounds(),
+                                                 RenderShape::Bullet, interpolation);
             }
-            break;
-            
-        case GameState::GameOver:
-            player.draw(window);
-            
-            for (auto& obstacle : obstacles) {
-                obstacle->draw(window);
+            {
+                PROFILE_SCOPE(renderProfiler, "obstacles");
+                drawObstacles(snapshot);
+            }
+            {
+                PROFILE_SCOPE(renderProfiler, "ui");
+                drawUI(snapshot);
+                drawDebugInfo(snapshot);
+                
+                if (snapshot.state == GameState::GameOver) {
+                    drawGameOverUI(snapshot);
+                } else if (snapshot.showInstructions) {
+                    drawGameInstructions(snapshot);
+                }
             }
-            
-            drawUI();
-            drawDebugInfo();
-            drawGameOverUI();
             break;
+        }
+    }
+    
+    // 覆盖层显示的是上一帧的绘制调用次数（本帧的还没有统计完）
+    lastDrawCalls = drawCalls;
+    
+    if (showProfiler) {
+        PROFILE_SCOPE(renderProfiler, "profiler");
+        drawProfilerOverlay(snapshot);
     }
     
+    // display() 会等待限帧/垂直同步，之前的部分才是本帧的实际工作时间
+    frameWorkTime = frameClock.getElapsedTime().asSeconds();
+    
+    PROFILE_SCOPE(renderProfiler, "display");
     window.display();
 }
 
-void Game::drawStartScreen() {
+void Game::draw(const sf::Drawable& drawable) {
+    window.draw(drawable);
+    drawCalls++;
+}
+
+void Game::drawProfilerOverlay(const RenderSnapshot& snapshot) {
+    ProfilerOverlay::Counters counters;
+    counters.activeParticles = snapshot.activeParticles;
+    counters.drawnParticles = snapshot.particles.getParticleCount();
+    counters.particleBudget = snapshot.particleBudget;
+    counters.drawCalls = lastDrawCalls;
+    counters.fps = fps;
+    
+    profilerOverlay.draw(window, renderProfiler, snapshot.simulationProfile, counters);
+}
+
+sf::FloatRect Game::getViewBounds() const {
+    const sf::View& view = window.getView();
+    return sf::FloatRect(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+}
+
+void Game::drawObstacles(const RenderSnapshot& snapshot) {
+    // 粒子顶点已由模拟线程按可见区域收集，每个图层一次绘制调用
+    drawCalls += particleRenderer.draw(window, snapshot.particles, ParticleRenderer::Layer::Under);
+    
+    drawCalls += entityRenderer.draw(window, snapshot.entities, getViewBounds(), RenderShape::Obstacle,
+                                     interpolation);
+    
+    drawCalls += particleRenderer.draw(window, snapshot.particles, ParticleRenderer::Layer::Over);
+}
+
+void Game::drawStartScreen(const RenderSnapshot& snapshot) {
+    // 文字阴影随画质开关，改变时重新生成缓存
+    bool textShadows = qualityController.getSettings().textShadows;
+    drawCalls += startScreenLayer.draw(window, textShadows ? 1 : 0, [this, textShadows](sf::RenderTarget& target) {
+        buildStartScreen(target, textShadows);
+    });
+    
+    // 闪烁的提示每帧绘制
+    if (snapshot.blinkTimer < 0.5f) {
+        pressAnyKeyText.setFillColor(sf::Color::White);
+    }
+    else {
+        pressAnyKeyText.setFillColor(sf::Color(255, 255, 255, 128));
+    }
+    draw(pressAnyKeyText);
+}
+
+void Game::buildStartScreen(sf::RenderTarget& target, bool textShadows) {
     sf::Text titleText("Simple Runner with Particles", font, 48);
     titleText.setFillColor(sf::Color::Yellow);
     titleText.setStyle(sf::Text::Bold);
@@ -273,9 +383,9 @@ void Game::drawStartScreen() {
     titleCircle.setOutlineThickness(3);
     titleCircle.setOrigin(60, 60);
     titleCircle.setPosition(Config::WINDOW_WIDTH / 2.0f, 100);
-    window.draw(titleCircle);
+    target.draw(titleCircle);
     
-    window.draw(titleText);
+    target.draw(titleText);
     
     // 增大黑框，适应更多文字
     sf::RectangleShape instructionBox(sf::Vector2f(650, 380));
@@ -283,7 +393,7 @@ void Game::drawStartScreen() {
     instructionBox.setOutlineColor(sf::Color::White);
     instructionBox.setOutlineThickness(3);
     instructionBox.setPosition((Config::WINDOW_WIDTH - 650) / 2.0f, 170); // 下移一点
-    window.draw(instructionBox);
+    target.draw(instructionBox);
     
     sf::Text instructionTitle("Game Instructions", font, 28); // 减小字体
     instructionTitle.setFillColor(sf::Color::Cyan);
@@ -293,7 +403,7 @@ void Game::drawStartScreen() {
     instructionTitle.setOrigin(instructionTitleRect.left + instructionTitleRect.width / 2.0f,
                               instructionTitleRect.top + instructionTitleRect.height / 2.0f);
     instructionTitle.setPosition(Config::WINDOW_WIDTH / 2.0f, 200);
-    window.draw(instructionTitle);
+    target.draw(instructionTitle);
     
     // 更简洁的说明文本
     std::vector<std::string> instructions = {
@@ -316,6 +426,8 @@ void Game::drawStartScreen() {
         "- SPACE: Shoot bullets (max 3 for entire game)",
         "- ESC: Exit game",
         "- H: Toggle instructions",
+        "- F3: Toggle performance overlay",
+        "- F4: Start/stop timeline trace",
         "- M: Return to menu",
         "- R: Restart after game over",
         "",
@@ -348,132 +460,150 @@ void Game::drawStartScreen() {
         
         lineText.setPosition(Config::WINDOW_WIDTH / 2.0f - 300, yPos); // 左边距加大
         
-        // 绘制文本阴影效果
-        sf::Text shadowText = lineText;
-        shadowText.setFillColor(sf::Color(0, 0, 0, 150));
-        shadowText.setPosition(lineText.getPosition().x + 2, lineText.getPosition().y + 2);
-        window.draw(shadowText);
+        // 绘制文本阴影效果（低画质时跳过）
+        if (textShadows) {
+            sf::Text shadowText = lineText;
+            shadowText.setFillColor(sf::Color(0, 0, 0, 150));
+            shadowText.setPosition(lineText.getPosition().x + 2, lineText.getPosition().y + 2);
+            target.draw(shadowText);
+        }
         
-        window.draw(lineText);
+        target.draw(lineText);
         yPos += (line.empty() ? 6 : 10);  // 空行间距小，有内容行间距大
     }
     
-    // 将"按任意键开始"下移，避免重叠
-    if (blinkTimer < 0.5f) {
-        pressAnyKeyText.setFillColor(sf::Color::White);
-        window.draw(pressAnyKeyText);
-    }
-    else {
-        pressAnyKeyText.setFillColor(sf::Color(255, 255, 255, 128));
-        window.draw(pressAnyKeyText);
-    }
-    
-    // 绘制键盘提示
-    // sf::Text keyHintText("Press any key to start game", font, 20);
-    // keyHintText.setFillColor(sf::Color(255, 200, 100));
-    // sf::FloatRect hintRect = keyHintText.getLocalBounds();
-    // keyHintText.setOrigin(hintRect.left + hintRect.width / 2.0f,
-    //                      hintRect.top + hintRect.height / 2.0f);
-    // keyHintText.setPosition(Config::WINDOW_WIDTH / 2.0f, Config::WINDOW_HEIGHT - 50); // 放在底部
-    // window.draw(keyHintText);
-    
-    // 更新pressAnyKeyText位置，放在keyHintText上方
-    pressAnyKeyText.setPosition(Config::WINDOW_WIDTH / 2.0f, Config::WINDOW_HEIGHT - 100);
-    
     // 绘制版本信息
     sf::Text versionText("v1.0", font, 14);
     versionText.setFillColor(sf::Color(100, 100, 100));
     versionText.setPosition(Config::WINDOW_WIDTH - 50, Config::WINDOW_HEIGHT - 20);
-    window.draw(versionText);
+    target.draw(versionText);
     
     // 绘制简单装饰线
     sf::RectangleShape topLine(sf::Vector2f(400, 2));
     topLine.setFillColor(sf::Color(100, 200, 255, 150));
     topLine.setPosition(Config::WINDOW_WIDTH / 2.0f - 200, 160);
-    window.draw(topLine);
+    target.draw(topLine);
     
     sf::RectangleShape bottomLine(sf::Vector2f(400, 2));
     bottomLine.setFillColor(sf::Color(100, 200, 255, 150));
     bottomLine.setPosition(Config::WINDOW_WIDTH / 2.0f - 200, Config::WINDOW_HEIGHT - 120);
-    window.draw(bottomLine);
+    target.draw(bottomLine);
     
     // 绘制粒子效果示例
     sf::CircleShape fireExample(8);
     fireExample.setFillColor(sf::Color(255, 100, 50));
     fireExample.setPosition(Config::WINDOW_WIDTH / 2.0f + 200, 320);
-    window.draw(fireExample);
+    target.draw(fireExample);
     
     sf::CircleShape iceExample(8);
     iceExample.setFillColor(sf::Color(100, 200, 255));
     iceExample.setPosition(Config::WINDOW_WIDTH / 2.0f + 200, 345);
-    window.draw(iceExample);
+    target.draw(iceExample);
     
     sf::CircleShape electricExample(8);
     electricExample.setFillColor(sf::Color(200, 100, 255));
     electricExample.setPosition(Config::WINDOW_WIDTH / 2.0f + 200, 370);
-    window.draw(electricExample);
+    target.draw(electricExample);
     
     sf::CircleShape poisonExample(8);
     poisonExample.setFillColor(sf::Color(100, 255, 100));
     poisonExample.setPosition(Config::WINDOW_WIDTH / 2.0f + 200, 395);
-    window.draw(poisonExample);
+    target.draw(poisonExample);
 }
 
-void Game::drawGameInstructions() {
-    if (currentState == GameState::Playing) {
-        sf::RectangleShape background(sf::Vector2f(400, 180)); // 增加高度
-        background.setFillColor(sf::Color(0, 0, 0, 180));
-        background.setPosition(10, 10);
-        window.draw(background);
-        
-        sf::Text titleText("Game Instructions (Press H to hide)", font, 18);
-        titleText.setFillColor(sf::Color::Yellow);
-        titleText.setPosition(20, 15);
-        window.draw(titleText);
-        
-        sf::Text warningText("WARNING: You have ONLY 3 bullets for entire game!", 
-                            font, 14);
-        warningText.setFillColor(sf::Color::Red);
-        warningText.setStyle(sf::Text::Bold);
-        warningText.setPosition(20, 45);
-        window.draw(warningText);
-        
-        sf::Text movementText("Move: A/D/Left/Right (horiz) W/S/Up/Down (vert)", 
-                             font, 14);
-        movementText.setFillColor(sf::Color(100, 255, 100));
-        movementText.setPosition(20, 70);
-        window.draw(movementText);
-        
-        sf::Text bulletControlText("Press SPACE to shoot (3 bullets total, use wisely!)", 
-                                font, 14);
-        bulletControlText.setFillColor(sf::Color(100, 255, 255));
-        bulletControlText.setPosition(20, 95);
-        window.draw(bulletControlText);
-        
-        sf::Text obstacleText("Obstacle types: Fire(red) Ice(blue) Electric(purple) Poison(green)", 
-                             font, 14);
-        obstacleText.setFillColor(sf::Color::White);
-        obstacleText.setPosition(20, 120);
-        window.draw(obstacleText);
-        
-        sf::Text tipText("Tip: Save bullets for fast obstacles you can't dodge!", 
+void Game::drawGameInstructions(const RenderSnapshot& snapshot) {
+    if (snapshot.state == GameState::Playing) {
+        drawCalls += instructionsLayer.draw(window, 0, [this](sf::RenderTarget& target) {
+            buildGameInstructions(target);
+        });
+    }
+}
+
+void Game::buildGameInstructions(sf::RenderTarget& target) {
+    sf::RectangleShape background(sf::Vector2f(400, 180)); // 增加高度
+    background.setFillColor(sf::Color(0, 0, 0, 180));
+    background.setPosition(10, 10);
+    target.draw(background);
+    
+    sf::Text titleText("Game Instructions (Press H to hide)", font, 18);
+    titleText.setFillColor(sf::Color::Yellow);
+    titleText.setPosition(20, 15);
+    target.draw(titleText);
+    
+    sf::Text warningText("WARNING: You have ONLY 3 bullets for entire game!", 
                         font, 14);
-        tipText.setFillColor(sf::Color(255, 200, 100));
-        tipText.setPosition(20, 145);
-        window.draw(tipText);
-        
-        sf::Text eyesText("Player has blinking eyes! Watch them blink!", 
+    warningText.setFillColor(sf::Color::Red);
+    warningText.setStyle(sf::Text::Bold);
+    warningText.setPosition(20, 45);
+    target.draw(warningText);
+    
+    sf::Text movementText("Move: A/D/Left/Right (horiz) W/S/Up/Down (vert)", 
+                         font, 14);
+    movementText.setFillColor(sf::Color(100, 255, 100));
+    movementText.setPosition(20, 70);
+    target.draw(movementText);
+    
+    sf::Text bulletControlText("Press SPACE to shoot (3 bullets total, use wisely!)", 
+                            font, 14);
+    bulletControlText.setFillColor(sf::Color(100, 255, 255));
+    bulletControlText.setPosition(20, 95);
+    target.draw(bulletControlText);
+    
+    sf::Text obstacleText("Obstacle types: Fire(red) Ice(blue) Electric(purple) Poison(green)", 
                          font, 14);
-        eyesText.setFillColor(sf::Color(255, 200, 255));
-        eyesText.setPosition(20, 170);
-        window.draw(eyesText);
+    obstacleText.setFillColor(sf::Color::White);
+    obstacleText.setPosition(20, 120);
+    target.draw(obstacleText);
+    
+    sf::Text tipText("Tip: Save bullets for fast obstacles you can't dodge!", 
+                    font, 14);
+    tipText.setFillColor(sf::Color(255, 200, 100));
+    tipText.setPosition(20, 145);
+    target.draw(tipText);
+    
+    sf::Text eyesText("Player has blinking eyes! Watch them blink!", 
+                     font, 14);
+    eyesText.setFillColor(sf::Color(255, 200, 255));
+    eyesText.setPosition(20, 170);
+    target.draw(eyesText);
+}
+
+void Game::drawGameOverUI(const RenderSnapshot& snapshot) {
+    drawCalls += gameOverLayer.draw(window, 0, [this](sf::RenderTarget& target) {
+        buildGameOverUI(target);
+    });
+    
+    // 分数和等级每局不同，数值改变时重写文字
+    if (snapshot.score != finalScore) {
+        finalScore = snapshot.score;
+        std::stringstream scoreStream;
+        scoreStream << "Final Score: " << finalScore;
+        finalScoreText.setString(scoreStream.str());
+        sf::FloatRect textRect = finalScoreText.getLocalBounds();
+        finalScoreText.setOrigin(textRect.left + textRect.width / 2.0f,
+                                 textRect.top + textRect.height / 2.0f);
+        finalScoreText.setPosition(Config::WINDOW_WIDTH / 2.0f,
+                                   Config::WINDOW_HEIGHT / 2.0f - 20);
+    }
+    if (snapshot.speedLevel != finalLevel) {
+        finalLevel = snapshot.speedLevel;
+        std::stringstream levelStream;
+        levelStream << "Reached Speed Level: " << finalLevel;
+        finalLevelText.setString(levelStream.str());
+        sf::FloatRect textRect = finalLevelText.getLocalBounds();
+        finalLevelText.setOrigin(textRect.left + textRect.width / 2.0f,
+                                 textRect.top + textRect.height / 2.0f);
+        finalLevelText.setPosition(Config::WINDOW_WIDTH / 2.0f,
+                                   Config::WINDOW_HEIGHT / 2.0f + 20);
     }
+    draw(finalScoreText);
+    draw(finalLevelText);
 }
 
-void Game::drawGameOverUI() {
+void Game::buildGameOverUI(sf::RenderTarget& target) {
     sf::RectangleShape overlay(sf::Vector2f(Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT));
     overlay.setFillColor(sf::Color(0, 0, 0, 150));
-    window.draw(overlay);
+    target.draw(overlay);
     
     sf::Text gameOverText("GAME OVER!", font, 48);
     gameOverText.setFillColor(sf::Color::Red);
@@ -484,29 +614,7 @@ void Game::drawGameOverUI() {
                           textRect.top + textRect.height / 2.0f);
     gameOverText.setPosition(Config::WINDOW_WIDTH / 2.0f,
                             Config::WINDOW_HEIGHT / 2.0f - 80);
-    window.draw(gameOverText);
-    
-    std::stringstream scoreStream;
-    scoreStream << "Final Score: " << scoreSystem.getScore();
-    sf::Text scoreText(scoreStream.str(), font, 32);
-    scoreText.setFillColor(sf::Color::White);
-    textRect = scoreText.getLocalBounds();
-    scoreText.setOrigin(textRect.left + textRect.width / 2.0f,
-                       textRect.top + textRect.height / 2.0f);
-    scoreText.setPosition(Config::WINDOW_WIDTH / 2.0f,
-                         Config::WINDOW_HEIGHT / 2.0f - 20);
-    window.draw(scoreText);
-    
-    std::stringstream levelStream;
-    levelStream << "Reached Speed Level: " << speedLevel;
-    sf::Text levelText(levelStream.str(), font, 24);
-    levelText.setFillColor(sf::Color::Yellow);
-    textRect = levelText.getLocalBounds();
-    levelText.setOrigin(textRect.left + textRect.width / 2.0f,
-                       textRect.top + textRect.height / 2.0f);
-    levelText.setPosition(Config::WINDOW_WIDTH / 2.0f,
-                         Config::WINDOW_HEIGHT / 2.0f + 20);
-    window.draw(levelText);
+    target.draw(gameOverText);
     
     // 游戏结束提示 - 分开显示更清晰
     sf::Text restartText("Press R to restart game", font, 20);
@@ -516,7 +624,7 @@ void Game::drawGameOverUI() {
                          textRect.top + textRect.height / 2.0f);
     restartText.setPosition(Config::WINDOW_WIDTH / 2.0f,
                            Config::WINDOW_HEIGHT / 2.0f + 60);
-    window.draw(restartText);
+    target.draw(restartText);
     
     sf::Text menuText("Press M to return to menu", font, 20);
     menuText.setFillColor(sf::Color(100, 200, 255));
@@ -525,7 +633,7 @@ void Game::drawGameOverUI() {
                       textRect.top + textRect.height / 2.0f);
     menuText.setPosition(Config::WINDOW_WIDTH / 2.0f,
                         Config::WINDOW_HEIGHT / 2.0f + 90);
-    window.draw(menuText);
+    target.draw(menuText);
     
     sf::Text exitText("Press ESC to exit game", font, 16);
     exitText.setFillColor(sf::Color(255, 200, 100));
@@ -534,63 +642,55 @@ void Game::drawGameOverUI() {
                       textRect.top + textRect.height / 2.0f);
     exitText.setPosition(Config::WINDOW_WIDTH / 2.0f,
                         Config::WINDOW_HEIGHT / 2.0f + 120);
-    window.draw(exitText);
+    target.draw(exitText);
 }
 
-void Game::drawUI() {
-    scoreSystem.draw(window);
+void Game::drawUI(const RenderSnapshot& snapshot) {
+    scoreDisplay.setState(snapshot.score, snapshot.timeAlive);
+    scoreDisplay.draw(window);
+    drawCalls++;
     
-    if (currentState == GameState::Playing) {
+    if (snapshot.state == GameState::Playing) {
         // ... 原有的速度信息显示 ...
         
         // 修改子弹信息显示
         std::stringstream bulletStream;
-        bulletStream << "Bullets: " << player.getRemainingBullets() << "/" << 3;
+        bulletStream << "Bullets: " << snapshot.player.remainingBullets << "/" << 3;
         sf::Text bulletText(bulletStream.str(), font, 18);
         
         // 根据剩余子弹数改变颜色
-        if (player.getRemainingBullets() == 0) {
+        if (snapshot.player.remainingBullets == 0) {
             bulletText.setFillColor(sf::Color::Red);
-        } else if (player.getRemainingBullets() == 1) {
+        } else if (snapshot.player.remainingBullets == 1) {
             bulletText.setFillColor(sf::Color::Yellow);
         } else {
             bulletText.setFillColor(sf::Color::Cyan);
         }
         
         bulletText.setPosition(Config::WINDOW_WIDTH - 200, 120);
-        window.draw(bulletText);
+        draw(bulletText);
         
         // 显示警告信息（如果没有子弹了）
-        if (player.getRemainingBullets() == 0) {
+        if (snapshot.player.remainingBullets == 0) {
             sf::Text warningText("NO BULLETS LEFT!", font, 14);
             warningText.setFillColor(sf::Color::Red);
             warningText.setStyle(sf::Text::Bold);
             warningText.setPosition(Config::WINDOW_WIDTH - 200, 145);
-            window.draw(warningText);
+            draw(warningText);
         }
         
         // ... 原有的冷却指示器 ...
     }
 }
 
-void Game::drawDebugInfo() {
+void Game::drawDebugInfo(const RenderSnapshot& snapshot) {
     std::stringstream debugStream;
-    debugStream << "Obstacles: " << obstacles.size();
+    debugStream << "Obstacles: " << snapshot.obstacleCount;
     
     sf::Text debugText(debugStream.str(), font, 16);
     debugText.setFillColor(sf::Color::White);
     debugText.setPosition(10, Config::WINDOW_HEIGHT - 40);
-    window.draw(debugText);
-    
-    static sf::Clock fpsClock;
-    static int frameCount = 0;
-    static float fps = 0.0f;
-    
-    frameCount++;
-    if (fpsClock.getElapsedTime().asSeconds() >= 1.0f) {
-        fps = frameCount / fpsClock.restart().asSeconds();
-        frameCount = 0;
-    }
+    draw(debugText);
     
     std::stringstream fpsStream;
     fpsStream << "FPS: " << static_cast<int>(fps);
@@ -598,100 +698,56 @@ void Game::drawDebugInfo() {
     sf::Text fpsText(fpsStream.str(), font, 16);
     fpsText.setFillColor(sf::Color::White);
     fpsText.setPosition(10, Config::WINDOW_HEIGHT - 20);
-    window.draw(fpsText);
+    draw(fpsText);
     
     std::stringstream timeStream;
-    timeStream << "Time: " << static_cast<int>(scoreSystem.getTimeAlive()) << "s";
+    timeStream << "Time: " << static_cast<int>(snapshot.timeAlive) << "s";
     
     sf::Text timeText(timeStream.str(), font, 16);
     timeText.setFillColor(sf::Color::White);
     timeText.setPosition(10, Config::WINDOW_HEIGHT - 60);
-    window.draw(timeText);
-}
+    draw(timeText);
 
-void Game::startGame() {
-    currentState = GameState::Playing;
-    player.reset();  // 这会重置子弹计数
-    obstacles.clear();
-    scoreSystem.reset();
-    obstacleSpawnTimer = 0.0f;
-    resetDifficulty();
-    showInstructions = true;
-    
-    std::cout << "===========================================" << std::endl;
-    std::cout << "Game Started!" << std::endl;
-    std::cout << "WARNING: You have only 3 bullets for the entire game!" << std::endl;
-    std::cout << "Controls: A/D, Left/Right Arrow to move horizontally" << std::endl;
-    std::cout << "          W/S, Up/Down Arrow to move vertically" << std::endl;
-    std::cout << "Press SPACE to shoot (3 bullets total)" << std::endl;
-    std::cout << "Press H to toggle instructions" << std::endl;
-    std::cout << "Press M to return to menu" << std::endl;
-    std::cout << "===========================================" << std::endl;
-}
+    std::stringstream particleStream;
+    particleStream << "Particles: " << snapshot.activeParticles
+                   << "/" << snapshot.particleBudget;
 
-void Game::updateDifficulty(float deltaTime) {
-    speedIncreaseTimer += deltaTime;
-    
-    if (speedIncreaseTimer >= Config::SPEED_INCREASE_INTERVAL) {
-        speedLevel++;
-        
-        currentObstacleSpeedMin += Config::SPEED_INCREASE_AMOUNT;
-        currentObstacleSpeedMax += Config::SPEED_INCREASE_AMOUNT;
-        
-        if (currentObstacleSpeedMax > Config::MAX_OBSTACLE_SPEED) {
-            currentObstacleSpeedMax = Config::MAX_OBSTACLE_SPEED;
-            currentObstacleSpeedMin = std::min(currentObstacleSpeedMin, Config::MAX_OBSTACLE_SPEED - 50);
-        }
-        
-        speedIncreaseTimer = 0.0f;
-        
-        std::cout << "===========================================" << std::endl;
-        std::cout << "Speed increased! Level: " << speedLevel << std::endl;
-        std::cout << "Obstacle speed range: " << currentObstacleSpeedMin 
-                  << " - " << currentObstacleSpeedMax << std::endl;
-        std::cout << "===========================================" << std::endl;
-    }
-}
+    sf::Text particleText(particleStream.str(), font, 16);
+    particleText.setFillColor(sf::Color::White);
+    particleText.setPosition(10, Config::WINDOW_HEIGHT - 80);
+    draw(particleText);
 
-void Game::spawnObstacle() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    
-    std::uniform_real_distribution<float> xDist(
-        Config::PARTICLE_OBSTACLE_RADIUS, 
-        Config::WINDOW_WIDTH - Config::PARTICLE_OBSTACLE_RADIUS);
-    
-    std::uniform_real_distribution<float> speedDist(
-        currentObstacleSpeedMin, currentObstacleSpeedMax);
-    
-    std::uniform_int_distribution<int> typeDist(0, 3);
-    
-    float x = xDist(gen);
-    float speed = speedDist(gen);
-    int typeIndex = typeDist(gen);
-    
-    ObstacleParticle::Type type;
-    switch (typeIndex) {
-        case 0: type = ObstacleParticle::Type::Fire; break;
-        case 1: type = ObstacleParticle::Type::Ice; break;
-        case 2: type = ObstacleParticle::Type::Electric; break;
-        case 3: type = ObstacleParticle::Type::Poison; break;
-        default: type = ObstacleParticle::Type::Fire; break;
-    }
-    
-    obstacles.push_back(std::make_unique<ObstacleParticle>(x, -50, speed, type));
-    
-    static int obstacleCount = 0;
-    obstacleCount++;
-    if (obstacleCount % 5 == 0) {
-        std::cout << "Spawned obstacle #" << obstacleCount 
-                  << " (type: " << typeIndex << ", speed: " << speed << ", level: " << speedLevel << ")" << std::endl;
+    std::stringstream qualityStream;
+    qualityStream << "Quality: " << QualityController::getLevelName(qualityController.getLevel());
+
+    sf::Text qualityText(qualityStream.str(), font, 16);
+    qualityText.setFillColor(sf::Color::White);
+    qualityText.setPosition(10, Config::WINDOW_HEIGHT - 100);
+    draw(qualityText);
+
+    // 帧时间分布（平均帧率看不出的卡顿）
+    const FrameHistogram& frameTimes = performanceReport.getFrameTimes();
+    std::stringstream frameTimeStream;
+    frameTimeStream << std::fixed << std::setprecision(1)
+                    << "Frame p50/p99/max: " << frameTimes.getPercentile(50.0) / 1000.0
+                    << " / " << frameTimes.getPercentile(99.0) / 1000.0
+                    << " / " << frameTimes.getMax() / 1000.0 << " ms";
+    
+    sf::Text frameTimeText(frameTimeStream.str(), font, 16);
+    frameTimeText.setFillColor(sf::Color::White);
+    frameTimeText.setPosition(10, Config::WINDOW_HEIGHT - 140);
+    draw(frameTimeText);
+    
+    std::stringstream allocationStream;
+    if (AllocationCounter::isEnabled()) {
+        allocationStream << "Update allocs: " << snapshot.updateAllocations
+                         << " (total " << snapshot.playingAllocations << ")";
+    } else {
+        allocationStream << "Update allocs: off";
     }
-}
 
-void Game::resetDifficulty() {
-    speedIncreaseTimer = 0.0f;
-    currentObstacleSpeedMin = Config::OBSTACLE_SPEED_MIN;
-    currentObstacleSpeedMax = Config::OBSTACLE_SPEED_MAX;
-    speedLevel = 0;
-}
\ No newline at end of file
+    sf::Text allocationText(allocationStream.str(), font, 16);
+    allocationText.setFillColor(sf::Color::White);
+    allocationText.setPosition(10, Config::WINDOW_HEIGHT - 120);
+    draw(allocationText);
+}
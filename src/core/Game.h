@@ -2,68 +2,137 @@
 #define GAME_H
 
 #include <SFML/Graphics.hpp>
-#include <memory>
-#include <vector>
+#include <atomic>
+#include <thread>
 #include "Config.h"
-#include "../entities/Player.h"
-#include "../entities/ObstacleParticle.h"
+#include "RenderSnapshot.h"
+#include "Simulation.h"
+#include "../systems/CachedLayer.h"
+#include "../systems/EntityRenderer.h"
+#include "../systems/PlayerRenderer.h"
 #include "../systems/ScoreSystem.h"
+#include "../systems/ParticleRenderer.h"
+#include "../systems/QualityController.h"
+#include "../systems/PerformanceReport.h"
+#include "../systems/ProfilerOverlay.h"
+#include "../utils/AllocationCounter.h"
+#include "../utils/Logger.h"
+#include "../utils/Profiler.h"
+#include "../utils/Tracer.h"
+#include "../utils/SpscQueue.h"
+#include "../utils/TripleBuffer.h"
 
+// 游戏主循环
+// 模拟在单独的线程中按固定步长运行，每次更新后把渲染快照发布到三缓冲；
+// 主线程（窗口所在线程）处理窗口事件并转发给模拟线程，然后绘制最新的快照。
+// 两个线程之间只通过无锁队列、三缓冲和原子变量交换数据，互不等待。
 class Game {
 public:
     Game();
+    ~Game();
     void run();
-    
+
 private:
     void processEvents();
-    void update(float deltaTime);
-    void render();
-    
-    // 游戏状态 - 添加开始界面
-    enum class GameState {
-        StartScreen,  // 开始界面
-        Playing,      // 游戏中
-        GameOver      // 游戏结束
-    };
-    
-    GameState currentState;
-    sf::Clock gameClock;
-    float obstacleSpawnTimer;
-    
-    float speedIncreaseTimer;
-    float currentObstacleSpeedMin;
-    float currentObstacleSpeedMax;
-    int speedLevel;
-    
+    void render(const RenderSnapshot& snapshot);
+
+    // 模拟线程主循环：处理输入、按固定步长更新、发布快照
+    void simulationLoop();
+
+    // 启动/停止模拟线程
+    void startSimulation();
+    void stopSimulation();
+
     sf::RenderWindow window;
+
+    // 游戏状态（只由模拟线程访问）
+    Simulation simulation;
+
+    // 模拟线程 -> 渲染线程：最新的渲染快照
+    TripleBuffer<RenderSnapshot> snapshots;
+
+    // 渲染线程 -> 模拟线程：输入事件
+    SpscQueue<sf::Event, 256> inputQueue;
+
+    // 渲染线程选择的画质等级，模拟线程读取后应用到粒子池
+    std::atomic<int> qualityLevel;
+
+    std::thread simulationThread;
+    std::atomic<bool> simulationRunning;
+
+    // 两个线程共用的时间轴（快照发布时间和绘制时间都从这里读取）
+    sf::Clock timeline;
+
+    // 粒子顶点的渲染器（持有共享纹理）
+    ParticleRenderer particleRenderer;
+
+    // 障碍物和子弹的渲染器（共用形状）
+    EntityRenderer entityRenderer;
+
+    PlayerRenderer playerRenderer;
+
+    // 分数显示（数值来自快照）
+    ScoreSystem scoreDisplay;
+
+    // 根据帧时间自动调整装饰效果
+    QualityController qualityController;
+    sf::Clock frameClock;
+    float frameWorkTime;
     
-    Player player;
-    std::vector<std::unique_ptr<ObstacleParticle>> obstacles;
+    // 渲染线程的计时器和性能覆盖层（F3 切换）
+    Profiler renderProfiler;
+    ProfilerOverlay profilerOverlay;
+    bool showProfiler;
     
-    ScoreSystem scoreSystem;
+    // 本帧和上一帧的绘制调用次数
+    int drawCalls;
+    int lastDrawCalls;
     
-    sf::Font font;
+    // 每秒统计一次帧率
+    sf::Clock fpsClock;
+    int fpsFrameCount;
+    float fps;
     
-    // 开始界面相关
-    bool showInstructions;
-    float blinkTimer;
-    sf::Text pressAnyKeyText;
+    // 本次运行写出的时间线文件数（用于文件编号）
+    int traceCount;
     
-    void spawnObstacle();
-    bool checkCollisions();
-    void checkBulletCollisions();  // 新增：检查子弹碰撞
-    void drawUI();
-    void drawDebugInfo();
-    void drawStartScreen();  // 改为绘制开始界面
-    void drawGameInstructions();  // 游戏中的说明
-    void drawGameOverUI();  // 新增：绘制游戏结束界面
-    void updateDifficulty(float deltaTime);
-    void resetDifficulty();
-    void startGame();  // 开始游戏
+    // 帧时间分布和各速度等级的负载峰值
+    PerformanceReport performanceReport;
+    GameState lastState;  // 上一帧快照的状态（检测游戏结束）
+
+    // 本帧绘制时在上一次和最新一次模拟更新之间的位置（0 - 1）
+    float interpolation;
 
+    sf::Font font;
 
+    sf::Text pressAnyKeyText;
+    
+    // 静态界面缓存在渲染纹理中，只有闪烁提示和分数每帧绘制
+    CachedLayer startScreenLayer;
+    CachedLayer instructionsLayer;
+    CachedLayer gameOverLayer;
     
+    // 游戏结束界面的分数和等级（数值改变时才重写文字）
+    sf::Text finalScoreText;
+    sf::Text finalLevelText;
+    int finalScore;
+    int finalLevel;
 
+    void draw(const sf::Drawable& drawable);  // 绘制到窗口并计入绘制调用次数
+    void drawObstacles(const RenderSnapshot& snapshot);  // 绘制障碍物及其粒子
+    sf::FloatRect getViewBounds() const;  // 当前视图的可见区域（世界坐标）
+    void drawUI(const RenderSnapshot& snapshot);
+    void drawDebugInfo(const RenderSnapshot& snapshot);
+    void drawStartScreen(const RenderSnapshot& snapshot);  // 改为绘制开始界面
+    void drawGameInstructions(const RenderSnapshot& snapshot);  // 游戏中的说明
+    void drawGameOverUI(const RenderSnapshot& snapshot);  // 新增：绘制游戏结束界面
+    void buildStartScreen(sf::RenderTarget& target, bool textShadows);  // 开始界面的静态部分
+    void buildGameInstructions(sf::RenderTarget& target);
+    void buildGameOverUI(sf::RenderTarget& target);  // 游戏结束界面的静态部分
+    void drawProfilerOverlay(const RenderSnapshot& snapshot);
+    void updateQuality(float frameTime);  // 根据帧时间调整画质
+    void toggleTrace();  // 开始时间线记录，或停止并写出文件
+    void writeReport(const char* reason);
 };
 
-#endif
\ No newline at end of file
+#endif
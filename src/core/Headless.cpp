@@ -0,0 +1,77 @@
+#include "Headless.h"
+#include "RenderSnapshot.h"
+#include "Simulation.h"
+#include "../systems/NullRenderer.h"
+#include "../systems/QualityController.h"
+#include "../systems/ScriptedInput.h"
+#include "../utils/RandomService.h"
+#include <algorithm>
+
+HeadlessResult runHeadless(const HeadlessOptions& options) {
+    HeadlessResult result;
+
+    ScriptedInput input;
+    if (options.scriptPath.empty()) {
+        input.createAutoplay(options.ticks);
+    } else if (!input.loadFromFile(options.scriptPath)) {
+        return result;
+    }
+
+    // 种子必须在创建模拟之前设置（粒子系统创建时就从随机数服务取种子）
+    RandomService::getInstance().seed(options.seed);
+
+    Simulation simulation;
+    simulation.applyQualitySettings(QualityController::getSettings(QualityLevel::High));
+
+    const sf::FloatRect viewBounds(0.0f, 0.0f, Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT);
+    simulation.setViewBounds(viewBounds);
+
+    RenderSnapshot snapshot;
+    snapshot.entities.reserve(simulation.getEntityCapacity());
+    NullRenderer renderer;
+
+    sf::Clock clock;
+    GameState previousState = simulation.getState();
+
+    Profiler& profiler = simulation.getProfiler();
+
+    int tick = 0;
+    for (; tick < options.ticks; tick++) {
+        profiler.beginFrame();
+
+        sf::Event event;
+        while (input.pollEvent(tick, event)) {
+            simulation.handleEvent(event);
+        }
+
+        simulation.update(Config::SIMULATION_TICK_TIME);
+
+        // 与窗口模式相同，每一步都写出快照并"绘制"（插值比例取 1，即本次更新后的状态）
+        simulation.writeSnapshot(snapshot);
+        renderer.draw(snapshot, viewBounds, 1.0f);
+        profiler.endFrame();
+
+        if (snapshot.state == GameState::GameOver && previousState != GameState::GameOver) {
+            result.gamesFinished++;
+            result.bestScore = std::max(result.bestScore, snapshot.score);
+        }
+        if (snapshot.state != GameState::StartScreen) {
+            result.updateAllocations += snapshot.updateAllocations;
+        }
+        previousState = snapshot.state;
+
+        if (snapshot.quitRequested) {
+            tick++;
+            break;
+        }
+    }
+
+    result.ok = true;
+    result.ticks = tick;
+    result.seconds = clock.getElapsedTime().asMicroseconds() / 1000000.0;
+    result.finalScore = snapshot.score;
+    result.bestScore = std::max(result.bestScore, snapshot.score);
+    result.renderedEntities = renderer.getEntityCount();
+    result.renderedParticles = renderer.getParticleCount();
+    return result;
+}
@@ -0,0 +1,33 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include <cstdint>
+#include <string>
+#include "Config.h"
+
+// 无窗口运行参数
+struct HeadlessOptions {
+    int ticks = static_cast<int>(Config::SIMULATION_TICK_RATE) * 60;  // 模拟步数（默认为一分钟游戏时间）
+    std::uint64_t seed = 1;     // 随机数种子，相同的种子和脚本得到相同的结果
+    std::string scriptPath;     // 输入脚本，为空时使用内置的自动操作
+};
+
+// 无窗口运行结果
+struct HeadlessResult {
+    bool ok = false;            // 脚本加载失败时为 false
+    int ticks = 0;              // 实际执行的模拟步数（脚本按 ESC 时提前结束）
+    double seconds = 0.0;       // 实际耗时
+    int gamesFinished = 0;      // 结束的局数
+    int bestScore = 0;
+    int finalScore = 0;         // 最后一局（可能未结束）的分数
+    std::uint64_t renderedEntities = 0;
+    std::uint64_t renderedParticles = 0;
+    std::uint64_t updateAllocations = 0;  // 所有局模拟更新中的堆分配次数
+};
+
+// 无窗口运行完整的游戏模拟
+// 不创建窗口和 OpenGL 上下文：输入来自脚本，每一步都写出渲染快照并交给空渲染器。
+// 步与步之间不等待，以 CPU 允许的最快速度运行（用于长时间稳定性测试、性能测试和自动游玩）。
+HeadlessResult runHeadless(const HeadlessOptions& options);
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef RENDER_SNAPSHOT_H
+#define RENDER_SNAPSHOT_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+#include "../entities/Components.h"
+#include "../entities/Player.h"
+#include "../systems/ParticleRenderer.h"
+#include "../utils/Profiler.h"
+
+// 游戏状态
+enum class GameState {
+    StartScreen,  // 开始界面
+    Playing,      // 游戏中
+    GameOver      // 游戏结束
+};
+
+// 一个可绘制实体（障碍物或子弹）
+struct EntitySnapshot {
+    Transform transform;   // 含上一次更新后的值，绘制时插值
+    Render render;
+    float opacity = 1.0f;  // 淡出比例（有寿命的实体随剩余时间降低）
+};
+
+// 渲染快照
+// 模拟线程每次更新后把绘制需要的全部数据写入快照，通过三缓冲交给渲染线程。
+// 渲染线程只读取快照，不访问模拟状态；快照中的容器保留容量，稳定运行时不分配内存。
+struct RenderSnapshot {
+    GameState state = GameState::StartScreen;
+
+    // 发布时间（与渲染线程共用的时钟，秒）和当时剩余不足一步的模拟时间，
+    // 渲染线程据此计算绘制时刻在上一次和本次更新之间的位置
+    float publishTime = 0.0f;
+    float pendingTime = 0.0f;
+
+    PlayerSnapshot player;
+    std::vector<EntitySnapshot> entities;
+    ParticleBatch particles;
+
+    // 界面数据
+    int score = 0;
+    float timeAlive = 0.0f;
+    int speedLevel = 0;
+    bool showInstructions = true;
+    float blinkTimer = 0.0f;
+
+    // 调试信息
+    std::size_t obstacleCount = 0;
+    int activeParticles = 0;
+    int particleBudget = 0;
+    std::uint64_t updateAllocations = 0;
+    std::uint64_t playingAllocations = 0;
+
+    // 模拟线程各阶段的耗时统计
+    Profiler::Summary simulationProfile;
+
+    // 模拟请求退出（游戏中按 ESC）
+    bool quitRequested = false;
+};
+
+#endif
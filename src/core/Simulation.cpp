@@ -0,0 +1,385 @@
+#include "Simulation.h"
+#include "../entities/Bullet.h"
+#include "../systems/EntitySystems.h"
+#include "../utils/AllocationCounter.h"
+#include "../utils/Logger.h"
+#include "../utils/RandomService.h"
+#include <algorithm>
+#include <cstdlib>
+
+Simulation::Simulation()
+    : currentState(GameState::StartScreen),
+      obstacleSpawnTimer(0.0f),
+      speedIncreaseTimer(0.0f),
+      currentObstacleSpeedMin(Config::OBSTACLE_SPEED_MIN),
+      currentObstacleSpeedMax(Config::OBSTACLE_SPEED_MAX),
+      speedLevel(0),
+      player(registry),
+      threadPool(0, (Config::PARTICLE_POOL_SYSTEMS + Config::PARTICLE_PARALLEL_GRAIN - 1) /
+                        Config::PARTICLE_PARALLEL_GRAIN),
+      obstacles(registry, particlePool),
+      viewBounds(0.0f, 0.0f, Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT),
+      showInstructions(true),
+      blinkTimer(0.0f),
+      quitRequested(false),
+      updateAllocations(0),
+      playingAllocations(0) {
+
+    // 预留碰撞和销毁缓冲区，模拟更新中不再分配内存
+    collisionSystem.reserve(registry.getCapacity());
+    contacts.reserve(registry.getCapacity());
+    expiredEntities.reserve(registry.getCapacity());
+
+    particlePool.setViewBounds(viewBounds);
+}
+
+void Simulation::setViewBounds(const sf::FloatRect& bounds) {
+    viewBounds = bounds;
+    particlePool.setViewBounds(viewBounds);
+}
+
+void Simulation::applyQualitySettings(const QualitySettings& settings) {
+    particlePool.setEmissionMultiplier(settings.emissionScale);
+    particlePool.setMinSizeScale(settings.minSizeScale);
+    particlePool.setAuraEnabled(settings.auraEnabled);
+    particlePool.setBudget(static_cast<int>(Config::PARTICLE_BUDGET * settings.budgetScale));
+}
+
+void Simulation::handleEvent(const sf::Event& event) {
+    // 失去焦点时收不到松开按键的事件，清空按键状态避免玩家一直移动
+    if (event.type == sf::Event::LostFocus) {
+        input = PlayerInput();
+        return;
+    }
+
+    if (event.type == sf::Event::KeyReleased) {
+        handleKey(event.key.code, false);
+        return;
+    }
+
+    if (event.type != sf::Event::KeyPressed) {
+        return;
+    }
+
+    handleKey(event.key.code, true);
+
+    if (currentState == GameState::StartScreen) {
+        startGame();
+        return;
+    }
+
+    // 重新开始游戏 (仅限游戏结束状态)
+    if (event.key.code == sf::Keyboard::R && currentState == GameState::GameOver) {
+        currentState = GameState::Playing;
+        player.reset();
+        clearEntities();
+        scoreSystem.reset();
+        obstacleSpawnTimer = 0.0f;
+        playingAllocations = 0;
+        resetDifficulty();
+        LOG_INFO(LogCategory::Game, "Game restarted, speed reset to level 0");
+    }
+
+    // 退出游戏（窗口属于渲染线程，由它在读到快照后关闭）
+    if (event.key.code == sf::Keyboard::Escape) {
+        quitRequested = true;
+    }
+
+    // 切换说明显示（游戏中）
+    if (event.key.code == sf::Keyboard::H && currentState == GameState::Playing) {
+        showInstructions = !showInstructions;
+        LOG_DEBUG(LogCategory::Game, "Instructions %s", showInstructions ? "shown" : "hidden");
+    }
+
+    // 返回菜单（游戏中或游戏结束都可以）
+    if (event.key.code == sf::Keyboard::M &&
+       (currentState == GameState::Playing || currentState == GameState::GameOver)) {
+        returnToMenu();
+    }
+}
+
+void Simulation::handleKey(sf::Keyboard::Key key, bool pressed) {
+    switch (key) {
+        case sf::Keyboard::Left:
+        case sf::Keyboard::A:
+            input.left = pressed;
+            break;
+        case sf::Keyboard::Right:
+        case sf::Keyboard::D:
+            input.right = pressed;
+            break;
+        case sf::Keyboard::Up:
+        case sf::Keyboard::W:
+            input.up = pressed;
+            break;
+        case sf::Keyboard::Down:
+        case sf::Keyboard::S:
+            input.down = pressed;
+            break;
+        case sf::Keyboard::Space:
+            input.shoot = pressed;
+            break;
+        default:
+            break;
+    }
+}
+
+void Simulation::update(float deltaTime) {
+    PROFILE_SCOPE(profiler, "update");
+    
+    bool playing = currentState == GameState::Playing;
+#if defined(SIMPLERUNNER_ALLOCATION_BUDGET) && defined(SIMPLERUNNER_TRACK_ALLOCATIONS)
+    // 一帧可能执行多次更新，只统计本次更新中各代码段的分配
+    Profiler::AllocationMark allocationMark;
+    profiler.markAllocations(allocationMark);
+#endif
+    std::uint64_t allocationsBefore = AllocationCounter::getThreadAllocationCount();
+    simulate(deltaTime);
+    updateAllocations = AllocationCounter::getThreadAllocationCount() - allocationsBefore;
+    if (currentState != GameState::StartScreen) {
+        playingAllocations += updateAllocations;
+    }
+    
+#if defined(SIMPLERUNNER_ALLOCATION_BUDGET) && defined(SIMPLERUNNER_TRACK_ALLOCATIONS)
+    // Debug 和性能测试构建：游戏进行中超出分配预算立即终止，并指出分配最多的代码段
+    if (playing && updateAllocations > static_cast<std::uint64_t>(Config::ALLOCATION_BUDGET_PER_TICK)) {
+        const char* scope = profiler.getTopAllocatingScope(allocationMark);
+        LOG_ERROR(LogCategory::Game, "Allocation budget exceeded: %llu allocation(s) in one update (budget %d), mostly in '%s'",
+                  static_cast<unsigned long long>(updateAllocations), Config::ALLOCATION_BUDGET_PER_TICK,
+                  scope ? scope : "update");
+        Logger::getInstance().flush();
+        std::abort();
+    }
+#else
+    (void)playing;
+#endif
+}
+
+void Simulation::simulate(float deltaTime) {
+    // 记录更新前的状态，绘制时插值（不更新的状态下前后一致，画面保持静止）
+    EntitySystems::storePreviousTransforms(registry);
+    player.storePreviousPosition();
+
+    if (currentState == GameState::StartScreen) {
+        blinkTimer += deltaTime;
+        if (blinkTimer >= 1.0f) {
+            blinkTimer = 0.0f;
+        }
+        return;
+    }
+
+    if (currentState != GameState::Playing) {
+        return;
+    }
+
+    {
+        PROFILE_SCOPE(profiler, "player");
+        player.update(deltaTime, input);
+    }
+
+    {
+        PROFILE_SCOPE(profiler, "entities");
+
+        // 移动所有障碍物和子弹
+        EntitySystems::updateMovement(registry, deltaTime);
+
+        // 移除寿命结束或离开可见区域的实体
+        expiredEntities.clear();
+        EntitySystems::updateLifetimes(registry, deltaTime, expiredEntities);
+        EntitySystems::collectOffscreen(registry, viewBounds, expiredEntities);
+        for (Entity entity : expiredEntities) {
+            EntitySystems::destroyEntity(registry, particlePool, entity);
+        }
+
+        EntitySystems::syncEmitters(registry, particlePool);
+    }
+
+    {
+        PROFILE_SCOPE(profiler, "particles");
+
+        // 统一更新所有粒子（包括已移除障碍物留下的效果），不可见的系统降低更新频率
+        particlePool.update(deltaTime, threadPool);
+    }
+
+    {
+        PROFILE_SCOPE(profiler, "spawn");
+        obstacleSpawnTimer += deltaTime;
+        if (obstacleSpawnTimer >= Config::PARTICLE_OBSTACLE_SPAWN_TIME) {
+            spawnObstacle();
+            obstacleSpawnTimer = 0.0f;
+        }
+    }
+
+    scoreSystem.update(deltaTime);
+    updateDifficulty(deltaTime);
+
+    bool playerHit;
+    {
+        PROFILE_SCOPE(profiler, "collisions");
+
+        // 按本次更新后的位置重建碰撞网格，然后检测子弹与障碍物的碰撞
+        collisionSystem.update(registry);
+        checkBulletCollisions();
+
+        // 检测玩家与障碍物的碰撞
+        playerHit = checkCollisions();
+    }
+
+    if (playerHit) {
+        currentState = GameState::GameOver;
+        LOG_INFO(LogCategory::Game, "Game over! Final score: %d, speed level: %d, heap allocations during update: %llu",
+                 scoreSystem.getScore(), speedLevel, static_cast<unsigned long long>(playingAllocations));
+    }
+}
+
+void Simulation::writeSnapshot(RenderSnapshot& snapshot) {
+    PROFILE_SCOPE(profiler, "snapshot");
+    
+    snapshot.state = currentState;
+    player.writeSnapshot(snapshot.player);
+
+    // 障碍物和子弹
+    snapshot.entities.clear();
+    const Render* renders = registry.renders.data();
+    const Entity* entities = registry.renders.entities();
+    for (std::size_t i = 0; i < registry.renders.size(); i++) {
+        EntitySnapshot entity;
+        entity.transform = registry.transforms.get(entities[i]);
+        entity.render = renders[i];
+        if (const Lifetime* lifetime = registry.lifetimes.find(entities[i])) {
+            entity.opacity = lifetime->getRemainingRatio();
+        }
+        snapshot.entities.push_back(entity);
+    }
+
+    // 可见的粒子
+    snapshot.particles.clear();
+    if (currentState != GameState::StartScreen) {
+        particlePool.collect(snapshot.particles);
+    }
+
+    snapshot.score = scoreSystem.getScore();
+    snapshot.timeAlive = scoreSystem.getTimeAlive();
+    snapshot.speedLevel = speedLevel;
+    snapshot.showInstructions = showInstructions;
+    snapshot.blinkTimer = blinkTimer;
+
+    snapshot.obstacleCount = obstacles.getCount();
+    snapshot.activeParticles = particlePool.getActiveParticleCount();
+    snapshot.particleBudget = particlePool.getBudget();
+    snapshot.updateAllocations = updateAllocations;
+    snapshot.playingAllocations = playingAllocations;
+
+    snapshot.quitRequested = quitRequested;
+
+    snapshot.simulationProfile = profiler.getSummary();
+}
+
+// 修改碰撞检测函数
+bool Simulation::checkCollisions() {
+    Entity obstacle = collisionSystem.findFirstOverlap(registry, player.getBounds(), CollisionLayer::Obstacle);
+    if (obstacle.isValid()) {
+        // 触发碰撞效果
+        obstacles.triggerCollisionEffect(obstacle);
+        // 注意：这里不再调用 triggerDestroyEffect()，而是直接标记为可移除
+        // 障碍物会播放粒子效果后自然消失
+
+        LOG_INFO(LogCategory::Collision, "Collision with obstacle type: %s at speed level %d",
+                 ObstacleParticle::getTypeName(obstacles.getType(obstacle)), speedLevel);
+
+        return true;
+    }
+    return false;
+}
+
+// 修改子弹碰撞检测函数
+void Simulation::checkBulletCollisions() {
+    // 一颗子弹只能击中一个障碍物（击中后的子弹不再有碰撞组件）
+    collisionSystem.findContacts(registry, CollisionLayer::Bullet, CollisionLayer::Obstacle, contacts);
+
+    for (const CollisionSystem::Contact& contact : contacts) {
+        // 触发子弹的销毁效果
+        Bullet::triggerDestroyEffect(registry, contact.first);
+
+        // 障碍物立即销毁
+        obstacles.destroyImmediately(contact.second);
+
+        // 增加分数（击碎障碍物得50分）
+        scoreSystem.addScore(50);
+
+        LOG_INFO(LogCategory::Collision, "Obstacle destroyed! +50 points");
+    }
+}
+
+void Simulation::clearEntities() {
+    // 先清空粒子池：所有借用的句柄随之失效，注册表清空时无需逐个归还
+    particlePool.clear();
+    registry.clear();
+}
+
+void Simulation::startGame() {
+    currentState = GameState::Playing;
+    player.reset();  // 这会重置子弹计数
+    clearEntities();
+    scoreSystem.reset();
+    obstacleSpawnTimer = 0.0f;
+    playingAllocations = 0;
+    resetDifficulty();
+    showInstructions = true;
+
+    LOG_INFO(LogCategory::Game, "Game started! You have only 3 bullets for the entire game");
+}
+
+void Simulation::returnToMenu() {
+    currentState = GameState::StartScreen;
+    player.reset();
+    clearEntities();
+    scoreSystem.reset();
+    obstacleSpawnTimer = 0.0f;
+    resetDifficulty();
+    blinkTimer = 0.0f; // 重置闪烁计时器
+    LOG_INFO(LogCategory::Game, "Returned to start screen");
+}
+
+void Simulation::updateDifficulty(float deltaTime) {
+    speedIncreaseTimer += deltaTime;
+
+    if (speedIncreaseTimer >= Config::SPEED_INCREASE_INTERVAL) {
+        speedLevel++;
+
+        currentObstacleSpeedMin += Config::SPEED_INCREASE_AMOUNT;
+        currentObstacleSpeedMax += Config::SPEED_INCREASE_AMOUNT;
+
+        if (currentObstacleSpeedMax > Config::MAX_OBSTACLE_SPEED) {
+            currentObstacleSpeedMax = Config::MAX_OBSTACLE_SPEED;
+            currentObstacleSpeedMin = std::min(currentObstacleSpeedMin, Config::MAX_OBSTACLE_SPEED - 50);
+        }
+
+        speedIncreaseTimer = 0.0f;
+
+        LOG_INFO(LogCategory::Difficulty, "Speed increased! Level: %d, obstacle speed range: %.0f - %.0f",
+                 speedLevel, currentObstacleSpeedMin, currentObstacleSpeedMax);
+    }
+}
+
+void Simulation::spawnObstacle() {
+    RandomStream& random = RandomService::getInstance().stream(RandomChannel::Spawn);
+
+    float x = random.range(Config::PARTICLE_OBSTACLE_RADIUS,
+                           Config::WINDOW_WIDTH - Config::PARTICLE_OBSTACLE_RADIUS);
+    float speed = random.range(currentObstacleSpeedMin, currentObstacleSpeedMax);
+    int typeIndex = random.rangeInt(0, ObstacleParticle::TYPE_COUNT - 1);
+    auto type = static_cast<ObstacleParticle::Type>(typeIndex);
+
+    obstacles.spawn(x, -50, speed, type);
+
+    LOG_DEBUG(LogCategory::Spawn, "Spawned obstacle (type: %s, speed: %.1f, level: %d)",
+              ObstacleParticle::getTypeName(type), speed, speedLevel);
+}
+
+void Simulation::resetDifficulty() {
+    speedIncreaseTimer = 0.0f;
+    currentObstacleSpeedMin = Config::OBSTACLE_SPEED_MIN;
+    currentObstacleSpeedMax = Config::OBSTACLE_SPEED_MAX;
+    speedLevel = 0;
+}
@@ -0,0 +1,109 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+#include "Config.h"
+#include "EntityRegistry.h"
+#include "RenderSnapshot.h"
+#include "../entities/Player.h"
+#include "../entities/ObstacleParticle.h"
+#include "../systems/CollisionSystem.h"
+#include "../systems/ScoreSystem.h"
+#include "../systems/ParticlePool.h"
+#include "../systems/QualityController.h"
+#include "../utils/Profiler.h"
+#include "../utils/ThreadPool.h"
+
+// 游戏模拟
+// 持有全部游戏状态（玩家、障碍物、子弹、粒子、分数和难度），按固定步长更新。
+// 不访问窗口：输入以事件的形式传入，绘制所需的数据写入渲染快照。
+// 所有函数都应在同一个线程（模拟线程）中调用。
+class Simulation {
+public:
+    Simulation();
+
+    // 处理一个输入事件（按键、失去焦点）
+    void handleEvent(const sf::Event& event);
+
+    // 推进一个固定步长
+    void update(float deltaTime);
+
+    // 把绘制所需的数据写入快照（包括计时统计）
+    void writeSnapshot(RenderSnapshot& snapshot);
+
+    // 把画质参数应用到粒子池
+    void applyQualitySettings(const QualitySettings& settings);
+
+    // 可见区域（世界坐标），用于移除离开屏幕的实体和粒子剔除
+    void setViewBounds(const sf::FloatRect& bounds);
+
+    GameState getState() const { return currentState; }
+
+    // 可同时存在的实体数量上限（用于预留快照容量）
+    std::size_t getEntityCapacity() const { return registry.getCapacity(); }
+
+    // 模拟线程的计时器（帧的开始和结束由驱动模拟的循环标记）
+    Profiler& getProfiler() { return profiler; }
+
+private:
+    GameState currentState;
+    float obstacleSpawnTimer;
+
+    float speedIncreaseTimer;
+    float currentObstacleSpeedMin;
+    float currentObstacleSpeedMax;
+    int speedLevel;
+
+    // 障碍物和子弹实体（必须在玩家之前声明，玩家发射的子弹加入注册表）
+    EntityRegistry registry;
+
+    Player player;
+
+    // 由输入事件维护的按键状态
+    PlayerInput input;
+
+    // 粒子更新线程池
+    ThreadPool threadPool;
+
+    // 全局粒子池（障碍物实体通过 Emitter 组件借用粒子系统）
+    ParticlePool particlePool;
+    ObstacleParticle obstacles;
+
+    // 碰撞检测及其结果缓冲区
+    CollisionSystem collisionSystem;
+    std::vector<CollisionSystem::Contact> contacts;
+
+    // 本次更新需要销毁的实体（遍历组件数组时先收集，结束后统一销毁）
+    std::vector<Entity> expiredEntities;
+
+    ScoreSystem scoreSystem;
+
+    sf::FloatRect viewBounds;
+
+    // 界面状态
+    bool showInstructions;
+    float blinkTimer;
+    bool quitRequested;
+
+    Profiler profiler;
+
+    // 模拟更新中的堆分配次数（实体和粒子都已预分配，稳定运行时应为 0）
+    std::uint64_t updateAllocations;   // 上一次更新
+    std::uint64_t playingAllocations;  // 本局累计
+
+    void simulate(float deltaTime);
+    void handleKey(sf::Keyboard::Key key, bool pressed);
+
+    void spawnObstacle();
+    bool checkCollisions();
+    void checkBulletCollisions();
+    void clearEntities();  // 销毁所有障碍物、子弹和粒子
+    void updateDifficulty(float deltaTime);
+    void resetDifficulty();
+    void startGame();  // 开始游戏
+    void returnToMenu();
+};
+
+#endif
@@ -1,54 +1,41 @@
 #include "Bullet.h"
-#include <iostream>
-
-Bullet::Bullet(float x, float y) 
-    : speed(1000.0f), active(true), destroyTimer(0.0f) { // 增加速度到1000
-    
-    shape.setRadius(6.0f);
-    shape.setFillColor(sf::Color(255, 255, 200, 255)); // 淡黄色
-    shape.setOutlineColor(sf::Color(255, 255, 100, 255));
-    shape.setOutlineThickness(2.0f);
-    shape.setOrigin(6.0f, 6.0f);
-    shape.setPosition(x, y);
-    
-    originalColor = shape.getFillColor();
-}
 
-void Bullet::update(float deltaTime) {
-    if (!active) {
-        destroyTimer += deltaTime;
-        
-        // 销毁时的闪烁效果
-        if (destroyTimer < 0.3f) {
-            float alpha = 255.0f * (1.0f - destroyTimer / 0.3f);
-            sf::Color newColor = originalColor;
-            newColor.a = static_cast<sf::Uint8>(alpha);
-            shape.setFillColor(newColor);
-            shape.setOutlineColor(sf::Color(255, 255, 100, static_cast<sf::Uint8>(alpha)));
-        }
-        return;
-    }
-    
+Entity Bullet::spawn(EntityRegistry& registry, float x, float y) {
+    Entity bullet = registry.create();
+    if (!bullet.isValid()) return bullet;
+
+    registry.transforms.add(bullet, Transform(sf::Vector2f(x, y)));
+
     // 向上移动（负Y方向）
-    shape.move(0, -speed * deltaTime);
-}
+    Velocity velocity;
+    velocity.linear = sf::Vector2f(0.0f, -SPEED);
+    registry.velocities.add(bullet, velocity);
 
-void Bullet::draw(sf::RenderWindow& window) const {
-    if (active || destroyTimer < 0.3f) {
-        window.draw(shape);
-    }
-}
+    // 碰撞盒包含描边
+    Collider collider;
+    float extent = RADIUS + OUTLINE_THICKNESS;
+    collider.halfSize = sf::Vector2f(extent, extent);
+    collider.layer = CollisionLayer::Bullet;
+    registry.colliders.add(bullet, collider);
 
-bool Bullet::isOffScreen() const {
-    // 检查是否完全离开屏幕上方
-    return shape.getPosition().y + shape.getRadius() < 0;
-}
+    Render render;
+    render.shape = RenderShape::Bullet;
+    render.fillColor = sf::Color(255, 255, 200, 255);    // 淡黄色
+    render.outlineColor = sf::Color(255, 255, 100, 255);
+    render.extent = extent;
+    registry.renders.add(bullet, render);
 
-sf::FloatRect Bullet::getBounds() const {
-    return shape.getGlobalBounds();
+    return bullet;
 }
 
-void Bullet::triggerDestroyEffect() {
-    active = false;
-    destroyTimer = 0.0f;
-}
\ No newline at end of file
+void Bullet::triggerDestroyEffect(EntityRegistry& registry, Entity bullet) {
+    if (!registry.isAlive(bullet)) return;
+
+    registry.velocities.remove(bullet);
+    registry.colliders.remove(bullet);
+
+    // 销毁时的淡出效果由渲染器按剩余寿命计算透明度
+    Lifetime lifetime;
+    lifetime.duration = DESTROY_TIME;
+    registry.lifetimes.add(bullet, lifetime);
+}
@@ -2,29 +2,22 @@
 #define BULLET_H
 
 #include <SFML/Graphics.hpp>
+#include "../core/EntityRegistry.h"
 
+// 子弹原型：创建子弹实体并处理击中后的状态变化
+// 子弹的移动、淡出、剔除和绘制都由通用的实体系统完成。
 class Bullet {
 public:
-    Bullet(float x, float y);
-    
-    void update(float deltaTime);
-    void draw(sf::RenderWindow& window) const;
-    
-    bool isOffScreen() const;
-    sf::FloatRect getBounds() const;
-    
-    bool isActive() const { return active; }
-    void setActive(bool active) { this->active = active; }
-    
-    void triggerDestroyEffect();
-    bool shouldRemove() const { return !active && destroyTimer >= 0.3f; }
-    
-private:
-    sf::CircleShape shape;
-    float speed;
-    bool active;
-    float destroyTimer;
-    sf::Color originalColor;
+    static constexpr float SPEED = 1000.0f;          // 向上飞行速度
+    static constexpr float RADIUS = 6.0f;
+    static constexpr float OUTLINE_THICKNESS = 2.0f;
+    static constexpr float DESTROY_TIME = 0.3f;      // 击中后淡出时间
+
+    // 在 (x, y) 创建一颗向上飞行的子弹（注册表已满时返回无效实体）
+    static Entity spawn(EntityRegistry& registry, float x, float y);
+
+    // 击中目标：停止移动、不再参与碰撞，淡出后由寿命系统销毁
+    static void triggerDestroyEffect(EntityRegistry& registry, Entity bullet);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,108 @@
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include "../systems/ParticlePool.h"
+
+// 实体组件（纯数据，由 EntityRegistry 按类型连续存放，逻辑全部在系统中）
+
+// 位置、旋转和缩放
+// 同时保存上一次模拟更新后的值，绘制时在两次更新之间插值
+struct Transform {
+    sf::Vector2f position;
+    float rotation = 0.0f;  // 角度
+    float scale = 1.0f;     // 脉冲缩放
+
+    sf::Vector2f previousPosition;
+    float previousRotation = 0.0f;
+    float previousScale = 1.0f;
+
+    Transform() = default;
+    explicit Transform(const sf::Vector2f& position) : position(position), previousPosition(position) {}
+
+    // 记录当前值，作为下一次更新的起点
+    void storePrevious() {
+        previousPosition = position;
+        previousRotation = rotation;
+        previousScale = scale;
+    }
+
+    // 上一次（alpha = 0）与本次（alpha = 1）更新之间的状态
+    Transform interpolate(float alpha) const {
+        Transform result;
+        result.position = previousPosition + (position - previousPosition) * alpha;
+        result.rotation = previousRotation + (rotation - previousRotation) * alpha;
+        result.scale = previousScale + (scale - previousScale) * alpha;
+        result.storePrevious();
+        return result;
+    }
+};
+
+// 运动参数
+// 除线速度和角速度外，障碍物还有随相位变化的水平摆动和缩放脉冲。
+struct Velocity {
+    sf::Vector2f linear;        // 像素/秒
+    float angular = 0.0f;       // 角度/秒
+    float phase = 0.0f;         // 摆动/脉冲相位
+    float phaseSpeed = 0.0f;    // 相位变化速度（弧度/秒）
+    float swing = 0.0f;         // 水平摆动幅度（像素/秒）
+    float pulse = 0.0f;         // 缩放脉冲幅度（0.1 表示 ±10%）
+};
+
+// 碰撞层
+enum class CollisionLayer : std::uint8_t {
+    Obstacle,
+    Bullet
+};
+
+// 轴对齐碰撞盒（以位置为中心，随缩放变化）
+struct Collider {
+    sf::Vector2f halfSize;
+    CollisionLayer layer = CollisionLayer::Obstacle;
+
+    sf::FloatRect getBounds(const Transform& transform) const {
+        sf::Vector2f extent = halfSize * transform.scale;
+        return sf::FloatRect(transform.position - extent, extent * 2.0f);
+    }
+};
+
+// 从粒子池借用的粒子系统，实体销毁时归还
+struct Emitter {
+    ParticleHandle trail;
+    ParticleHandle aura;
+    ParticleHandle burst;       // 碰撞爆发
+    std::uint8_t preset = 0;    // 效果预设下标（ObstacleParticle::Type）
+};
+
+// 有限寿命：计时结束后实体被销毁（例如击中目标后淡出的子弹）
+struct Lifetime {
+    float elapsed = 0.0f;
+    float duration = 0.0f;
+
+    float getRemainingRatio() const {
+        return duration > 0.0f ? 1.0f - elapsed / duration : 0.0f;
+    }
+};
+
+// 绘制的形状种类
+enum class RenderShape : std::uint8_t {
+    Obstacle,  // 核心圆 + 反向旋转的方形外框
+    Bullet     // 带描边的小圆
+};
+
+// 绘制参数（形状由渲染器共用，实体只保存颜色）
+struct Render {
+    RenderShape shape = RenderShape::Obstacle;
+    sf::Color fillColor;
+    sf::Color outlineColor;
+    float extent = 0.0f;  // 缩放为 1 时可见包围盒的半边长（任意旋转下都包含整个形状）
+
+    sf::FloatRect getBounds(const Transform& transform) const {
+        float size = extent * transform.scale;
+        return sf::FloatRect(transform.position.x - size, transform.position.y - size,
+                             size * 2.0f, size * 2.0f);
+    }
+};
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef EFFECT_PRESETS_H
+#define EFFECT_PRESETS_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include "ObstacleParticle.h"
+#include "ParticleSystem.h"
+#include "ParticleBehavior.h"
+
+// 障碍物粒子效果预设
+// 同一类型的所有障碍物共用同一份只读参数，编译期构建。
+// SFML 2.5 的 sf::Color / sf::Vector2f 不是字面类型，这里用简单结构体保存，
+// 借用粒子系统时再转换成 EmitterConfig。
+// 新增效果类型：在 ObstacleParticle::Type 中加一项，再在 EFFECT_PRESETS 中加一行。
+
+struct PresetColor {
+    std::uint8_t r, g, b, a;
+
+    sf::Color toColor() const { return sf::Color(r, g, b, a); }
+};
+
+struct PresetVector {
+    float x, y;
+
+    sf::Vector2f toVector() const { return sf::Vector2f(x, y); }
+};
+
+// 一个粒子发射器的参数
+struct EmitterPreset {
+    bool enabled;                   // 该类型是否使用这个发射器
+    PresetVector positionVariance;  // 位置变化范围
+    PresetVector velocity;          // 基础速度
+    PresetVector speedVelocity;     // 与障碍物速度成比例的附加速度（乘以速度）
+    PresetVector velocityVariance;  // 速度变化范围
+    PresetColor startColor;         // 起始颜色
+    PresetColor endColor;           // 结束颜色
+    float minSize;
+    float maxSize;
+    float minLifetime;
+    float maxLifetime;
+    float emissionRate;             // 每秒发射粒子数（0 表示一次性发射）
+    int maxParticles;
+    ParticleBehavior behavior;      // 粒子行为
+    int burstCount;                 // 一次性发射的数量（持续发射时不使用）
+
+    // 按障碍物的位置和速度生成发射器配置
+    ParticleSystem::EmitterConfig toEmitterConfig(const sf::Vector2f& position, float speed) const {
+        ParticleSystem::EmitterConfig config;
+        config.position = position;
+        config.positionVariance = positionVariance.toVector();
+        config.velocity = sf::Vector2f(velocity.x + speedVelocity.x * speed,
+                                       velocity.y + speedVelocity.y * speed);
+        config.velocityVariance = velocityVariance.toVector();
+        config.startColor = startColor.toColor();
+        config.endColor = endColor.toColor();
+        config.minSize = minSize;
+        config.maxSize = maxSize;
+        config.minLifetime = minLifetime;
+        config.maxLifetime = maxLifetime;
+        config.emissionRate = emissionRate;
+        config.maxParticles = maxParticles;
+        config.continuous = emissionRate > 0;
+        return config;
+    }
+};
+
+// 一种障碍物类型的全部外观
+struct EffectPreset {
+    PresetColor coreColor;     // 核心填充颜色
+    PresetColor outlineColor;  // 外框颜色
+    EmitterPreset trail;       // 拖尾粒子
+    EmitterPreset aura;        // 光环粒子
+};
+
+// 不使用的发射器
+inline constexpr EmitterPreset NO_EMITTER = {
+    false, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0, ParticleBehavior::Default, 0
+};
+
+// 按 ObstacleParticle::Type 顺序排列
+inline constexpr EffectPreset EFFECT_PRESETS[] = {
+    // Fire：红色到橙色，火焰拖尾向上飘散 + 火焰边缘光环
+    {
+        {255, 100, 50, 200}, {255, 200, 100, 100},
+        {true, {5, 5}, {0, 0}, {0, -0.3f}, {20, 10}, {255, 150, 50, 255}, {255, 50, 0, 0},
+         3.0f, 8.0f, 0.3f, 0.8f, 30.0f, 100, ParticleBehavior::Fire, 0},
+        {true, {25, 25}, {0, 0}, {0, 0}, {10, 10}, {255, 200, 100, 100}, {255, 100, 0, 0},
+         1.0f, 4.0f, 0.5f, 1.0f, 40.0f, 150, ParticleBehavior::Default, 0}
+    },
+    // Ice：蓝色到青色，冰晶拖尾缓慢飘落
+    {
+        {100, 200, 255, 200}, {150, 230, 255, 100},
+        {true, {3, 3}, {0, -10}, {0, 0}, {5, 5}, {150, 230, 255, 200}, {100, 180, 255, 0},
+         2.0f, 6.0f, 0.5f, 1.5f, 20.0f, 80, ParticleBehavior::Ice, 0},
+        NO_EMITTER
+    },
+    // Electric：紫色到蓝色，电弧光环快速闪烁移动
+    {
+        {150, 100, 255, 200}, {200, 150, 255, 100},
+        NO_EMITTER,
+        {true, {20, 20}, {0, 0}, {0, 0}, {30, 30}, {200, 150, 255, 150}, {100, 50, 200, 0},
+         1.0f, 3.0f, 0.2f, 0.5f, 80.0f, 200, ParticleBehavior::Electric, 0}
+    },
+    // Poison：绿色到黄色，毒雾拖尾
+    {
+        {100, 255, 100, 200}, {200, 255, 100, 100},
+        {true, {8, 8}, {0, -5}, {0, 0}, {15, 5}, {100, 255, 100, 150}, {50, 150, 50, 0},
+         4.0f, 10.0f, 0.8f, 1.5f, 15.0f, 60, ParticleBehavior::Default, 0},
+        NO_EMITTER
+    }
+};
+
+static_assert(sizeof(EFFECT_PRESETS) / sizeof(EFFECT_PRESETS[0]) == ObstacleParticle::TYPE_COUNT,
+              "每种障碍物类型都需要一个效果预设");
+
+// 碰撞爆发（颜色使用障碍物的核心颜色）
+inline constexpr EmitterPreset COLLISION_BURST = {
+    true, {20, 20}, {0, 0}, {0, 0}, {200, 200}, {0, 0, 0, 0}, {0, 0, 0, 0},
+    3.0f, 10.0f, 0.2f, 0.8f, 0.0f, 50, ParticleBehavior::Default, 30
+};
+
+inline const EffectPreset& getEffectPreset(ObstacleParticle::Type type) {
+    int index = static_cast<int>(type);
+    if (index < 0 || index >= ObstacleParticle::TYPE_COUNT) index = 0;
+    return EFFECT_PRESETS[index];
+}
+
+#endif
@@ -2,9 +2,16 @@
 #define OBSTACLE_PARTICLE_H
 
 #include <SFML/Graphics.hpp>
-#include <memory>
 #include "ParticleSystem.h"
+#include "../core/EntityRegistry.h"
+#include "../systems/ParticlePool.h"
 
+struct EmitterPreset;
+
+// 粒子障碍物原型
+// 障碍物的数据保存在注册表的组件中（Transform、Velocity、Collider、Emitter、Render），
+// 这里只负责按类型创建实体、借用粒子系统，以及碰撞/击碎时的效果。
+// 移动、剔除、发射器位置同步和绘制由通用的实体系统完成。
 class ObstacleParticle {
 public:
     // 障碍物类型（不同外观）
@@ -15,106 +22,51 @@ public:
         Poison,    // 毒雾效果
         Random     // 随机类型
     };
-    
-    ObstacleParticle(float x, float y, float speed, Type type = Type::Random);
-    ~ObstacleParticle();
-    
-    void adjustSpeed(float multiplier);  // 调整速度
-    
-    // 更新障碍物和粒子系统
-    void update(float deltaTime);
-    
-    // 绘制障碍物和粒子
-    void draw(sf::RenderWindow& window) const;
-    
-    // 检查是否离开屏幕
-    bool isOffScreen() const;
-    
-    // 获取碰撞边界（主形状）
-    sf::FloatRect getBounds() const;
-    
-    // 获取位置
-    sf::Vector2f getPosition() const;
-    
-    // 获取速度
-    float getSpeed() const;
-    
-    // 设置速度
-    void setSpeed(float speed);
-    
-    // 设置类型
-    void setType(Type type);
-    
+
+    // 具体类型的数量（不含 Random），效果预设表按此大小排列
+    static constexpr int TYPE_COUNT = static_cast<int>(Type::Random);
+
+    // 主形状尺寸
+    static constexpr float CORE_RADIUS = 20.0f;        // 核心圆半径（碰撞范围）
+    static constexpr float OUTLINE_SIZE = 40.0f;       // 旋转外框边长
+    static constexpr float OUTLINE_THICKNESS = 3.0f;
+    static constexpr float PULSE_AMOUNT = 0.1f;        // 缩放脉冲幅度
+
+    // 粒子效果从全局粒子池借用，实体销毁时归还
+    ObstacleParticle(EntityRegistry& registry, ParticlePool& particlePool);
+
+    // 创建障碍物实体（障碍物池已满时返回无效实体）
+    Entity spawn(float x, float y, float speed, Type type = Type::Random);
+
     // 触发碰撞粒子效果
-    void triggerCollisionEffect();
-    
-    // 触发立即销毁（子弹击中）
-    void destroyImmediately();  // 新增：立即销毁
-    
-    // 检查是否应该被移除
-    bool shouldRemove() const;
-    
+    void triggerCollisionEffect(Entity obstacle);
+
+    // 被子弹击中：停止发射并播放碰撞效果，实体立即销毁（剩余粒子由粒子池继续播放）
+    void destroyImmediately(Entity obstacle);
+
     // 获取类型
-    Type getType() const { return currentType; }
-    
-    // 检查是否被子弹击中
-    bool isHitByBullet() const { return hitByBullet; }  // 新增
-    
+    Type getType(Entity obstacle) const;
+
+    // 类型名称（日志用）
+    static const char* getTypeName(Type type);
+
+    // 当前障碍物数量
+    std::size_t getCount() const { return registry.emitters.size(); }
+
 private:
-    // 主形状（核心障碍物）
-    sf::CircleShape coreShape;
-    sf::RectangleShape outlineShape;
-    
-    // 物理属性
-    sf::Vector2f position;
-    float speed;
-    float rotation;
-    float rotationSpeed;
-    float pulseScale;
-    float pulseSpeed;
-    float pulseTime;
-    
-    // 类型相关属性
-    Type currentType;
-    sf::Color coreColor;
-    sf::Color outlineColor;
-    
-    // 粒子系统
-    std::unique_ptr<ParticleSystem> trailSystem;
-    std::unique_ptr<ParticleSystem> auraSystem;
-    std::unique_ptr<ParticleSystem> collisionSystem;
-    
-    // 状态
-    bool isActive;
-    bool isDestroying;
-    bool hitByBullet;  // 新增：是否被子弹击中
-    float destroyTimer;
-    float maxDestroyTime;
-    
-    // 初始化函数
-    void initCore();
-    void initParticleSystems();
-    void setupByType(Type type);
-    
-    // 更新函数
-    void updatePosition(float deltaTime);
-    void updateRotation(float deltaTime);
-    void updatePulse(float deltaTime);
-    void updateParticleSystems(float deltaTime);
-    
-    // 粒子系统配置
-    void setupFireEffect();
-    void setupIceEffect();
-    void setupElectricEffect();
-    void setupPoisonEffect();
-    
-    // 工具函数
-    void setCoreColors(const sf::Color& core, const sf::Color& outline);
-    void createDestroyParticles();
-    
+    EntityRegistry& registry;
+    ParticlePool& particlePool;
+
+    // 按预设借用并启动持续发射的系统
+    void startEmitter(ParticleHandle& handle, const EmitterPreset& emitter, ParticlePriority priority,
+                      const sf::Vector2f& position, float speed, float phase);
+
+    // 按预设发射一次性的碰撞/销毁粒子（颜色使用障碍物的核心颜色）
+    void emitBurst(Entity obstacle, const EmitterPreset& emitter);
+
     // 随机数生成
     float randomFloat(float min, float max) const;
     int randomInt(int min, int max) const;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,109 +1,62 @@
 #include "Particle.h"
-#include <iostream>
-
-Particle::Particle()
-    : size(5.0f), lifetime(0.0f), maxLifetime(1.0f),
-      rotation(0.0f), rotationSpeed(0.0f), state(State::Dead) {
-}
-
-void Particle::init(const sf::Vector2f& position,
-                   const sf::Vector2f& velocity,
-                   float lifetime,
-                   const sf::Color& color,
-                   float size) {
-    this->position = position;
-    this->velocity = velocity;
-    this->color = color;
-    this->originalColor = color;
-    this->size = size;
-    this->originalSize = size;
-    this->lifetime = lifetime;
-    this->maxLifetime = lifetime;
-    this->rotation = 0.0f;
-    this->rotationSpeed = 0.0f;
-    this->state = State::Active;
-}
-
-void Particle::update(float deltaTime) {
-    if (!isAlive()) return;
-    
-    // 更新生命周期
-    lifetime -= deltaTime;
-    
-    // 检查状态
-    if (lifetime <= 0) {
-        state = State::Dead;
-        return;
+#include <algorithm>
+#include <cmath>
+
+void ParticleStorage::reserve(std::size_t count) {
+    positions.reserve(count);
+    velocities.reserve(count);
+    colors.reserve(count);
+    lifetimes.reserve(count);
+    maxLifetimes.reserve(count);
+    sizes.reserve(count);
+}
+
+void ParticleStorage::resize(std::size_t count) {
+    positions.resize(count);
+    velocities.resize(count);
+    colors.resize(count);
+    lifetimes.resize(count);
+    maxLifetimes.resize(count);
+    sizes.resize(count);
+}
+
+void ParticleStorage::clear() {
+    resize(0);
+}
+
+void ParticleStorage::swapRemove(std::size_t index) {
+    std::size_t last = size() - 1;
+    if (index != last) {
+        positions[index] = positions[last];
+        velocities[index] = velocities[last];
+        colors[index] = colors[last];
+        lifetimes[index] = lifetimes[last];
+        maxLifetimes[index] = maxLifetimes[last];
+        sizes[index] = sizes[last];
     }
-    
-    // 如果剩余时间少于0.3秒，进入淡出状态
-    if (lifetime < 0.3f && state == State::Active) {
-        state = State::Fading;
-    }
-    
-    // 如果有自定义更新器，使用它
-    if (customUpdater) {
-        customUpdater(*this, deltaTime);
-        return;
-    }
-    
-    // 默认物理更新
-    position += velocity * deltaTime;
-    
-    // 更新旋转
-    rotation += rotationSpeed * deltaTime;
-    
-    // 更新颜色和大小
-    updateColor();
-    updateSize();
+    resize(last);
 }
 
-void Particle::draw(sf::RenderWindow& window) const {
-    if (!isAlive()) return;
-    
-    // 创建圆形粒子
-    sf::CircleShape particleShape(size);
-    
-    // 根据状态设置颜色
-    sf::Color drawColor = color;
-    if (state == State::Fading) {
-        // 淡出效果：降低透明度
-        float alpha = (lifetime / 0.3f) * 255.0f;
-        drawColor.a = static_cast<sf::Uint8>(alpha);
+namespace {
+    // 四舍五入并截断到 [min, max]
+    long quantize(float value, float scale, long min, long max) {
+        long quantized = std::lround(value * scale);
+        return std::min(std::max(quantized, min), max);
     }
-    
-    particleShape.setFillColor(drawColor);
-    particleShape.setPosition(position);
-    particleShape.setOrigin(size, size); // 中心点作为原点
-    particleShape.setRotation(rotation);
-    
-    window.draw(particleShape);
 }
 
-bool Particle::isAlive() const {
-    return state != State::Dead;
+PackedVelocity ParticleStorage::packVelocity(const sf::Vector2f& velocity) {
+    PackedVelocity packed;
+    packed.x = static_cast<std::int16_t>(quantize(velocity.x, VELOCITY_SCALE, INT16_MIN, INT16_MAX));
+    packed.y = static_cast<std::int16_t>(quantize(velocity.y, VELOCITY_SCALE, INT16_MIN, INT16_MAX));
+    return packed;
 }
 
-float Particle::getLifeRatio() const {
-    if (maxLifetime <= 0) return 0.0f;
-    return lifetime / maxLifetime;
+std::uint16_t ParticleStorage::packLifetime(float seconds) {
+    // 至少 1 tick，新粒子不会在发射当帧之前就被视为死亡
+    return static_cast<std::uint16_t>(quantize(seconds, TICKS_PER_SECOND, 1, UINT16_MAX));
 }
 
-void Particle::setUpdater(std::function<void(Particle&, float)> updater) {
-    customUpdater = updater;
+std::uint8_t ParticleStorage::packSize(float size) {
+    return static_cast<std::uint8_t>(quantize(size, SIZE_SCALE, 0, UINT8_MAX));
 }
-
-void Particle::updateColor() {
-    float lifeRatio = getLifeRatio();
-    
-    // 根据生命周期改变颜色
-    color.r = static_cast<sf::Uint8>(originalColor.r * lifeRatio);
-    color.g = static_cast<sf::Uint8>(originalColor.g * lifeRatio);
-    color.b = static_cast<sf::Uint8>(originalColor.b * lifeRatio);
-    color.a = static_cast<sf::Uint8>(originalColor.a * lifeRatio);
-}
-
-void Particle::updateSize() {
-    float lifeRatio = getLifeRatio();
-    size = originalSize * (0.5f + 0.5f * lifeRatio); // 逐渐缩小
-}
\ No newline at end of file
@@ -2,79 +2,103 @@
 #define PARTICLE_H
 
 #include <SFML/Graphics.hpp>
-#include <functional>
-#include <cmath>
-
-class Particle {
-public:
-    // 生命周期状态
-    enum class State {
-        Active,    // 活跃状态
-        Fading,    // 淡出状态
-        Dead       // 死亡状态
-    };
-
-    Particle();
-    
-    // 初始化粒子
-    void init(const sf::Vector2f& position, 
-              const sf::Vector2f& velocity,
-              float lifetime,
-              const sf::Color& color,
-              float size);
-    
-    // 更新粒子状态
-    void update(float deltaTime);
-    
-    // 绘制粒子
-    void draw(sf::RenderWindow& window) const;
-    
-    // 检查粒子是否还活着
-    bool isAlive() const;
-    
-    // 获取状态
-    State getState() const { return state; }
-    
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// 定点速度（1/VELOCITY_SCALE 像素/秒）
+struct PackedVelocity {
+    std::int16_t x;
+    std::int16_t y;
+};
+
+// 粒子数据存储（SoA布局：每个属性一个连续数组）
+// 下标 i 在所有数组中对应同一个粒子
+//
+// 装饰粒子不需要完整精度，除位置外都以量化形式保存，每个粒子共 21 字节：
+//   位置       2 x float   8 字节（行为策略逐帧做亚像素位移，保留浮点）
+//   速度       2 x int16   4 字节（定点，±1024 像素/秒）
+//   初始颜色   RGBA8       4 字节
+//   生命周期   2 x uint16  4 字节（剩余/总计，单位 tick）
+//   初始大小   uint8       1 字节（定点，最大约 32 像素）
+// 当前颜色和大小由生命周期比例推导，不再单独存储；粒子不绘制旋转，旋转已去掉。
+struct ParticleStorage {
+    // 生命周期单位：1 tick = 1 毫秒，最长约 65 秒
+    static constexpr float TICKS_PER_SECOND = 1000.0f;
+
+    // 速度、大小的定点缩放
+    static constexpr float VELOCITY_SCALE = 32.0f;
+    static constexpr float SIZE_SCALE = 8.0f;
+
+    // 剩余时间少于该值时开始淡出
+    static constexpr float FADE_TIME = 0.3f;
+    static constexpr std::uint16_t FADE_TICKS = static_cast<std::uint16_t>(FADE_TIME * TICKS_PER_SECOND);
+
+    // 每个粒子占用的字节数（所有数组合计）
+    static constexpr std::size_t BYTES_PER_PARTICLE =
+        sizeof(sf::Vector2f) + sizeof(PackedVelocity) + sizeof(sf::Color) +
+        2 * sizeof(std::uint16_t) + sizeof(std::uint8_t);
+
+    std::vector<sf::Vector2f> positions;
+    std::vector<PackedVelocity> velocities;
+    std::vector<sf::Color> colors;
+    std::vector<std::uint16_t> lifetimes;
+    std::vector<std::uint16_t> maxLifetimes;
+    std::vector<std::uint8_t> sizes;
+
+    std::size_t size() const { return positions.size(); }
+    bool empty() const { return positions.empty(); }
+
+    // 预留容量（不改变粒子数量）
+    void reserve(std::size_t count);
+
+    // 调整粒子数量（新粒子需要调用者初始化）
+    void resize(std::size_t count);
+
+    // 清空所有粒子（保留容量）
+    void clear();
+
+    // 交换删除：用最后一个粒子覆盖 index 处的粒子，O(1)
+    void swapRemove(std::size_t index);
+
+    // 已预留的内存（字节）
+    std::size_t capacityBytes() const { return positions.capacity() * BYTES_PER_PARTICLE; }
+
+    // 量化（超出范围时截断到可表示的最大值）
+    static PackedVelocity packVelocity(const sf::Vector2f& velocity);
+    static std::uint16_t packLifetime(float seconds);
+    static std::uint8_t packSize(float size);
+
+    sf::Vector2f getVelocity(std::size_t index) const {
+        return sf::Vector2f(velocities[index].x / VELOCITY_SCALE, velocities[index].y / VELOCITY_SCALE);
+    }
+
     // 获取剩余生命周期比例 (0.0 - 1.0)
-    float getLifeRatio() const;
-    
-    // 设置自定义更新函数
-    void setUpdater(std::function<void(Particle&, float)> updater);
-    
-    // 获取当前位置
-    sf::Vector2f getPosition() const { return position; }
-    
-    // 设置位置
-    void setPosition(const sf::Vector2f& pos) { position = pos; }
-    
-    // 设置速度
-    void setVelocity(const sf::Vector2f& vel) { velocity = vel; }
-    
-    // 设置旋转
-    void setRotation(float rot) { rotation = rot; }
-    void setRotationSpeed(float speed) { rotationSpeed = speed; }
-    
-private:
-    sf::Vector2f position;
-    sf::Vector2f velocity;
-    sf::Color color;
-    sf::Color originalColor;
-    float size;
-    float originalSize;
-    float lifetime;
-    float maxLifetime;
-    float rotation;
-    float rotationSpeed;
-    State state;
-    
-    // 自定义更新函数
-    std::function<void(Particle&, float)> customUpdater;
-    
-    // 更新颜色（根据生命周期）
-    void updateColor();
-    
-    // 更新大小（根据生命周期）
-    void updateSize();
+    float getLifeRatio(std::size_t index) const {
+        if (maxLifetimes[index] == 0) return 0.0f;
+        return static_cast<float>(lifetimes[index]) / maxLifetimes[index];
+    }
+
+    // 获取当前大小（随生命周期缩小到一半）
+    float getSize(std::size_t index) const {
+        return sizes[index] / SIZE_SCALE * (0.5f + 0.5f * getLifeRatio(index));
+    }
+
+    // 获取绘制颜色（随生命周期变暗，最后阶段降低透明度淡出）
+    sf::Color getDrawColor(std::size_t index) const {
+        float lifeRatio = getLifeRatio(index);
+        const sf::Color& color = colors[index];
+        sf::Color drawColor(static_cast<sf::Uint8>(color.r * lifeRatio),
+                            static_cast<sf::Uint8>(color.g * lifeRatio),
+                            static_cast<sf::Uint8>(color.b * lifeRatio),
+                            static_cast<sf::Uint8>(color.a * lifeRatio));
+
+        std::uint16_t lifetime = lifetimes[index];
+        if (lifetime < FADE_TICKS) {
+            drawColor.a = static_cast<sf::Uint8>(lifetime * 255 / FADE_TICKS);
+        }
+        return drawColor;
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
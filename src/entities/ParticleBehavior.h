@@ -0,0 +1,84 @@
+#ifndef PARTICLE_BEHAVIOR_H
+#define PARTICLE_BEHAVIOR_H
+
+#include <SFML/Graphics.hpp>
+#include <cmath>
+
+// 粒子行为类型（每个粒子系统选择一种）
+enum class ParticleBehavior {
+    Default,   // 按速度运动
+    Fire,      // 火焰：向上飘，轻微左右摆动
+    Ice,       // 冰霜：缓慢飘落
+    Electric   // 电弧：整体快速闪烁移动
+};
+
+// 行为策略
+// 每个策略提供：
+//   USES_VELOCITY  是否同时按速度积分位置
+//   Frame          每个系统每帧只计算一次的统一参数
+//   prepare()      根据帧间隔和系统相位计算 Frame
+//   apply()        逐粒子更新位置（在更新循环中内联展开）
+
+struct DefaultBehavior {
+    static constexpr bool USES_VELOCITY = true;
+
+    struct Frame {};
+
+    static Frame prepare(float, float) { return Frame(); }
+
+    static void apply(sf::Vector2f&, float, const Frame&) {}
+};
+
+struct FireBehavior {
+    static constexpr bool USES_VELOCITY = false;
+
+    struct Frame {
+        float swing;  // 左右摆动幅度 * dt
+        float rise;   // 上升距离
+    };
+
+    static Frame prepare(float deltaTime, float) {
+        return { 10.0f * deltaTime, 50.0f * deltaTime };
+    }
+
+    static void apply(sf::Vector2f& position, float lifeRatio, const Frame& frame) {
+        position.x += std::sin(lifeRatio * 10) * frame.swing;
+        position.y -= frame.rise;
+    }
+};
+
+struct IceBehavior {
+    static constexpr bool USES_VELOCITY = false;
+
+    struct Frame {
+        float fall;  // 下落距离
+    };
+
+    static Frame prepare(float deltaTime, float) {
+        return { 20.0f * deltaTime };
+    }
+
+    static void apply(sf::Vector2f& position, float, const Frame& frame) {
+        position.y += frame.fall;
+    }
+};
+
+struct ElectricBehavior {
+    static constexpr bool USES_VELOCITY = false;
+
+    struct Frame {
+        sf::Vector2f offset;  // 本帧所有粒子共同的位移
+    };
+
+    // 相位来自障碍物的脉冲时间，sin/cos 每帧只算一次
+    static Frame prepare(float deltaTime, float phase) {
+        float time = phase * 5;
+        return { sf::Vector2f(std::sin(time) * 50 * deltaTime, std::cos(time) * 50 * deltaTime) };
+    }
+
+    static void apply(sf::Vector2f& position, float, const Frame& frame) {
+        position += frame.offset;
+    }
+};
+
+#endif
@@ -0,0 +1,238 @@
+#include "ParticleKernel.h"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PARTICLE_KERNEL_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(PARTICLE_KERNEL_X86) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define PARTICLE_KERNEL_SSE2 1
+#endif
+
+#if defined(PARTICLE_KERNEL_X86)
+#define PARTICLE_KERNEL_AVX2 1
+#if defined(__GNUC__) || defined(__clang__)
+#define PARTICLE_KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define PARTICLE_KERNEL_TARGET_AVX2
+#endif
+#endif
+
+namespace {
+    using IntegrateFunction = void (*)(ParticleStorage&, std::size_t, std::size_t, float, std::uint16_t);
+
+    // 各实现都以 ApplyMotion 为模板参数：
+    // true  = 完整更新（生命周期 + 速度积分）
+    // false = 只更新生命周期（位置由行为策略负责）
+    // 颜色和大小由生命周期比例推导，绘制时再计算。
+
+    // ---------------- 标量实现 ----------------
+
+    template <bool ApplyMotion>
+    void integrateScalar(ParticleStorage& particles, std::size_t begin, std::size_t end,
+                         float deltaTime, std::uint16_t ticks) {
+        // 定点速度转换为本帧位移的系数
+        const float velocityStep = deltaTime / ParticleStorage::VELOCITY_SCALE;
+
+        for (std::size_t i = begin; i < end; i++) {
+            // 生命周期减到0为止（饱和减法）
+            std::uint16_t lifetime = particles.lifetimes[i];
+            particles.lifetimes[i] = lifetime > ticks ? static_cast<std::uint16_t>(lifetime - ticks) : 0;
+
+            // 物理更新
+            if (ApplyMotion) {
+                const PackedVelocity& velocity = particles.velocities[i];
+                sf::Vector2f& position = particles.positions[i];
+                position.x += static_cast<float>(velocity.x) * velocityStep;
+                position.y += static_cast<float>(velocity.y) * velocityStep;
+            }
+        }
+    }
+
+    // 位置是连续的 float 对，速度是连续的 int16 对
+    float* positionData(ParticleStorage& particles) {
+        return reinterpret_cast<float*>(particles.positions.data());
+    }
+
+    const std::int16_t* velocityData(const ParticleStorage& particles) {
+        return reinterpret_cast<const std::int16_t*>(particles.velocities.data());
+    }
+
+    // ---------------- SSE2 实现 ----------------
+
+#if defined(PARTICLE_KERNEL_SSE2)
+    template <bool ApplyMotion>
+    void integrateSSE2(ParticleStorage& particles, std::size_t begin, std::size_t end,
+                       float deltaTime, std::uint16_t ticks) {
+        // 生命周期：每次8个粒子，无符号饱和减法
+        const __m128i tickVector = _mm_set1_epi16(static_cast<short>(ticks));
+        std::uint16_t* lifetimes = particles.lifetimes.data();
+
+        std::size_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            __m128i* lifetime = reinterpret_cast<__m128i*>(lifetimes + i);
+            _mm_storeu_si128(lifetime, _mm_subs_epu16(_mm_loadu_si128(lifetime), tickVector));
+        }
+
+        if (ApplyMotion) {
+            // 位置：每次4个粒子（8个 float / 8个 int16）
+            const __m128 step = _mm_set1_ps(deltaTime / ParticleStorage::VELOCITY_SCALE);
+            float* positions = positionData(particles);
+            const std::int16_t* velocities = velocityData(particles);
+
+            std::size_t j = begin;
+            for (; j + 4 <= i; j += 4) {
+                __m128i velocity = _mm_loadu_si128(reinterpret_cast<const __m128i*>(velocities + j * 2));
+
+                // int16 符号扩展为 int32：放到高16位后算术右移
+                __m128 low = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(velocity, velocity), 16));
+                __m128 high = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(velocity, velocity), 16));
+
+                float* position = positions + j * 2;
+                _mm_storeu_ps(position, _mm_add_ps(_mm_loadu_ps(position), _mm_mul_ps(low, step)));
+                _mm_storeu_ps(position + 4, _mm_add_ps(_mm_loadu_ps(position + 4), _mm_mul_ps(high, step)));
+            }
+        }
+
+        // 剩余不足一组的粒子（生命周期和位置一起处理）
+        integrateScalar<ApplyMotion>(particles, i, end, deltaTime, ticks);
+    }
+#endif
+
+    // ---------------- AVX2 实现 ----------------
+
+#if defined(PARTICLE_KERNEL_AVX2)
+    template <bool ApplyMotion>
+    PARTICLE_KERNEL_TARGET_AVX2
+    void integrateAVX2(ParticleStorage& particles, std::size_t begin, std::size_t end,
+                       float deltaTime, std::uint16_t ticks) {
+        // 生命周期：每次16个粒子
+        const __m256i tickVector = _mm256_set1_epi16(static_cast<short>(ticks));
+        std::uint16_t* lifetimes = particles.lifetimes.data();
+
+        std::size_t i = begin;
+        for (; i + 16 <= end; i += 16) {
+            __m256i* lifetime = reinterpret_cast<__m256i*>(lifetimes + i);
+            _mm256_storeu_si256(lifetime, _mm256_subs_epu16(_mm256_loadu_si256(lifetime), tickVector));
+        }
+
+        if (ApplyMotion) {
+            // 位置：每次8个粒子（16个 float / 16个 int16）
+            const __m256 step = _mm256_set1_ps(deltaTime / ParticleStorage::VELOCITY_SCALE);
+            float* positions = positionData(particles);
+            const std::int16_t* velocities = velocityData(particles);
+
+            std::size_t j = begin;
+            for (; j + 8 <= i; j += 8) {
+                const __m128i* velocity = reinterpret_cast<const __m128i*>(velocities + j * 2);
+                __m256 low = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(velocity)));
+                __m256 high = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(velocity + 1)));
+
+                float* position = positions + j * 2;
+                _mm256_storeu_ps(position, _mm256_add_ps(_mm256_loadu_ps(position), _mm256_mul_ps(low, step)));
+                _mm256_storeu_ps(position + 8, _mm256_add_ps(_mm256_loadu_ps(position + 8), _mm256_mul_ps(high, step)));
+            }
+        }
+
+        integrateScalar<ApplyMotion>(particles, i, end, deltaTime, ticks);
+    }
+#endif
+
+    // ---------------- 运行时分派 ----------------
+
+    bool cpuSupportsAVX2() {
+#if defined(PARTICLE_KERNEL_AVX2)
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#elif defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) return false;
+
+        // 需要操作系统保存 YMM 寄存器（OSXSAVE + XCR0）
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        if (!osxsave || (_xgetbv(0) & 0x6) != 0x6) return false;
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return false;
+#endif
+#else
+        return false;
+#endif
+    }
+
+    struct Dispatch {
+        ParticleKernel::Isa isa;
+        IntegrateFunction integrate;
+        IntegrateFunction fade;
+    };
+
+    Dispatch makeDispatch(ParticleKernel::Isa isa) {
+        switch (isa) {
+#if defined(PARTICLE_KERNEL_AVX2)
+            case ParticleKernel::Isa::AVX2:
+                return { isa, integrateAVX2<true>, integrateAVX2<false> };
+#endif
+#if defined(PARTICLE_KERNEL_SSE2)
+            case ParticleKernel::Isa::SSE2:
+                return { isa, integrateSSE2<true>, integrateSSE2<false> };
+#endif
+            default:
+                return { ParticleKernel::Isa::Scalar, integrateScalar<true>, integrateScalar<false> };
+        }
+    }
+
+    Dispatch& activeDispatch() {
+        static Dispatch dispatch = makeDispatch(ParticleKernel::detectIsa());
+        return dispatch;
+    }
+}
+
+namespace ParticleKernel {
+    Isa detectIsa() {
+        if (cpuSupportsAVX2()) return Isa::AVX2;
+#if defined(PARTICLE_KERNEL_SSE2)
+        return Isa::SSE2;
+#else
+        return Isa::Scalar;
+#endif
+    }
+
+    Isa getIsa() {
+        return activeDispatch().isa;
+    }
+
+    void setIsa(Isa isa) {
+        // 不超过CPU支持的最高指令集
+        Isa supported = detectIsa();
+        if (static_cast<int>(isa) > static_cast<int>(supported)) {
+            isa = supported;
+        }
+        activeDispatch() = makeDispatch(isa);
+    }
+
+    const char* getIsaName(Isa isa) {
+        switch (isa) {
+            case Isa::SSE2: return "SSE2";
+            case Isa::AVX2: return "AVX2";
+            default: return "Scalar";
+        }
+    }
+
+    void integrate(ParticleStorage& particles, float deltaTime, std::uint16_t ticks) {
+        activeDispatch().integrate(particles, 0, particles.size(), deltaTime, ticks);
+    }
+
+    void fade(ParticleStorage& particles, std::uint16_t ticks) {
+        activeDispatch().fade(particles, 0, particles.size(), 0.0f, ticks);
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef PARTICLE_KERNEL_H
+#define PARTICLE_KERNEL_H
+
+#include "Particle.h"
+
+// 粒子批量更新内核
+// 对 ParticleStorage 的连续数组整块推进，运行时按CPU支持选择 AVX2 / SSE2 / 标量实现。
+// 所有实现的结果逐位一致（位置的浮点运算顺序相同，生命周期为整数饱和减法）。
+namespace ParticleKernel {
+    // 指令集
+    enum class Isa {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    // 检测当前CPU支持的最高指令集
+    Isa detectIsa();
+
+    // 当前使用的指令集（首次调用时自动检测）
+    Isa getIsa();
+
+    // 强制使用某个指令集（不支持时降级到可用的最高指令集），用于性能对比
+    void setIsa(Isa isa);
+
+    // 指令集名称
+    const char* getIsaName(Isa isa);
+
+    // 默认物理更新：生命周期减少 ticks，位置按速度移动 deltaTime 秒
+    // 死亡粒子（生命周期为0）也会被推进，由调用者随后移除
+    void integrate(ParticleStorage& particles, float deltaTime, std::uint16_t ticks);
+
+    // 只更新生命周期，不做速度积分（位置由行为策略负责）
+    void fade(ParticleStorage& particles, std::uint16_t ticks);
+}
+
+#endif
@@ -1,12 +1,24 @@
 #include "ParticleSystem.h"
-#include <iostream>
+#include "ParticleKernel.h"
+#include "../utils/Tracer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // 同时包含两个矩形的最小矩形
+    sf::FloatRect mergeRects(const sf::FloatRect& a, const sf::FloatRect& b) {
+        float left = std::min(a.left, b.left);
+        float top = std::min(a.top, b.top);
+        float right = std::max(a.left + a.width, b.left + b.width);
+        float bottom = std::max(a.top + a.height, b.top + b.height);
+        return sf::FloatRect(left, top, right - left, bottom - top);
+    }
+}
 
 ParticleSystem::ParticleSystem()
-    : isEmitting(false), emissionTimer(0.0f) {
-    
-    // 初始化随机数生成器
-    std::random_device rd;
-    randomEngine.seed(rd());
+    : isEmitting(false), emissionTimer(0.0f), tickRemainder(0.0f), emissionScale(1.0f), minSizeScale(1.0f),
+      randomStream(RandomService::getInstance().stream(RandomChannel::Particles).nextU64()),
+      behavior(ParticleBehavior::Default), behaviorPhase(0.0f) {
     
     // 使用默认配置
 }
@@ -17,62 +29,78 @@ ParticleSystem::~ParticleSystem() {
 
 void ParticleSystem::setEmitter(const EmitterConfig& config) {
     emitterConfig = config;
+    
+    // 按最大粒子数预留空间，之后发射不再分配内存
+    reserve(config.maxParticles);
 }
 
 void ParticleSystem::burst(int count) {
-    for (int i = 0; i < count && particles.size() < emitterConfig.maxParticles; i++) {
-        auto particle = createParticle();
-        
-        // 随机位置
-        float posX = emitterConfig.position.x + 
-                     randomFloat(-emitterConfig.positionVariance.x, 
-                                 emitterConfig.positionVariance.x);
-        float posY = emitterConfig.position.y + 
-                     randomFloat(-emitterConfig.positionVariance.y, 
-                                 emitterConfig.positionVariance.y);
-        
-        // 随机速度
-        float velX = emitterConfig.velocity.x + 
-                     randomFloat(-emitterConfig.velocityVariance.x, 
-                                 emitterConfig.velocityVariance.x);
-        float velY = emitterConfig.velocity.y + 
-                     randomFloat(-emitterConfig.velocityVariance.y, 
-                                 emitterConfig.velocityVariance.y);
-        
-        // 随机生命周期
-        float lifetime = randomFloat(emitterConfig.minLifetime, 
-                                     emitterConfig.maxLifetime);
-        
-        // 随机大小
-        float size = randomFloat(emitterConfig.minSize, 
-                                 emitterConfig.maxSize);
-        
-        // 随机颜色（在起始颜色和结束颜色之间）
-        sf::Color color = randomColor(emitterConfig.startColor, 
-                                      emitterConfig.endColor);
-        
-        // 随机旋转速度
-        float rotationSpeed = randomFloat(-180.0f, 180.0f);
-        
-        particle->init(sf::Vector2f(posX, posY),
-                      sf::Vector2f(velX, velY),
-                      lifetime,
-                      color,
-                      size);
-        
-        particle->setRotationSpeed(rotationSpeed);
-        
-        // 设置自定义更新器
-        if (particleUpdater) {
-            particle->setUpdater(particleUpdater);
+    int available = emitterConfig.maxParticles - static_cast<int>(particles.size());
+    int emitCount = std::min(count, available);
+    if (emitCount <= 0) return;
+    
+    // 一次性扩展所有数组，然后按列批量填充随机属性
+    std::size_t first = particles.size();
+    std::size_t newCount = static_cast<std::size_t>(emitCount);
+    std::size_t last = first + newCount;
+    particles.reserve(last);
+    particles.resize(last);
+    
+    const EmitterConfig& config = emitterConfig;
+    const float* values;
+    
+    // 随机位置
+    values = randomColumn(newCount, -config.positionVariance.x, config.positionVariance.x);
+    for (std::size_t k = 0; k < newCount; k++) {
+        particles.positions[first + k].x = config.position.x + values[k];
+    }
+    values = randomColumn(newCount, -config.positionVariance.y, config.positionVariance.y);
+    for (std::size_t k = 0; k < newCount; k++) {
+        particles.positions[first + k].y = config.position.y + values[k];
+    }
+    
+    // 随机速度（量化为定点数）
+    values = randomColumn(newCount * 2, -1.0f, 1.0f);
+    for (std::size_t k = 0; k < newCount; k++) {
+        sf::Vector2f velocity(config.velocity.x + values[k] * config.velocityVariance.x,
+                              config.velocity.y + values[newCount + k] * config.velocityVariance.y);
+        particles.velocities[first + k] = ParticleStorage::packVelocity(velocity);
+    }
+    
+    // 随机生命周期（tick）
+    values = randomColumn(newCount, config.minLifetime, config.maxLifetime);
+    for (std::size_t k = 0; k < newCount; k++) {
+        particles.lifetimes[first + k] = ParticleStorage::packLifetime(values[k]);
+    }
+    std::copy_n(&particles.lifetimes[first], newCount, &particles.maxLifetimes[first]);
+    
+    // 随机大小
+    values = randomColumn(newCount, config.minSize * minSizeScale, config.maxSize);
+    for (std::size_t k = 0; k < newCount; k++) {
+        particles.sizes[first + k] = ParticleStorage::packSize(values[k]);
+    }
+    
+    // 随机颜色（在起始颜色和结束颜色之间，逐通道生成）
+    sf::Uint8 sf::Color::* const channels[] = { &sf::Color::r, &sf::Color::g, &sf::Color::b, &sf::Color::a };
+    for (sf::Uint8 sf::Color::* channel : channels) {
+        values = randomColumn(newCount, config.startColor.*channel, config.endColor.*channel);
+        for (std::size_t k = 0; k < newCount; k++) {
+            particles.colors[first + k].*channel = static_cast<sf::Uint8>(values[k]);
         }
-        
-        particles.push_back(std::move(particle));
+    }
+    
+    // 新粒子都在发射区域内，直接扩展包围盒
+    sf::FloatRect emitterBounds = getEmitterBounds();
+    if (first == 0) {
+        bounds = emitterBounds;
+    } else {
+        bounds = mergeRects(bounds, emitterBounds);
     }
 }
 
 void ParticleSystem::start() {
     isEmitting = true;
+    updateBounds();
 }
 
 void ParticleSystem::stop() {
@@ -80,38 +108,113 @@ void ParticleSystem::stop() {
 }
 
 void ParticleSystem::update(float deltaTime) {
-    // 处理持续发射
-    if (isEmitting && emitterConfig.continuous) {
+    TRACE_SCOPE("ParticleSystem::update");
+    
+    // 处理持续发射（到期的粒子一次性批量发射）
+    float emissionRate = emitterConfig.emissionRate * emissionScale;
+    if (isEmitting && emitterConfig.continuous && emissionRate > 0) {
         emissionTimer += deltaTime;
-        float timePerParticle = 1.0f / emitterConfig.emissionRate;
+        float timePerParticle = 1.0f / emissionRate;
         
-        while (emissionTimer >= timePerParticle && 
-               particles.size() < emitterConfig.maxParticles) {
-            burst(1);
-            emissionTimer -= timePerParticle;
+        int dueCount = static_cast<int>(emissionTimer / timePerParticle);
+        int available = emitterConfig.maxParticles - static_cast<int>(particles.size());
+        int emitCount = std::min(dueCount, available);
+        if (emitCount > 0) {
+            burst(emitCount);
+            emissionTimer -= emitCount * timePerParticle;
         }
+    } else {
+        // 暂停期间不累积，恢复时不会一次性补发
+        emissionTimer = 0.0f;
     }
     
-    // 更新所有活跃粒子
-    for (auto it = particles.begin(); it != particles.end(); ) {
-        auto& particle = *it;
-        
-        // 更新粒子
-        particle->update(deltaTime);
-        
-        // 如果粒子死亡，移除它
-        if (!particle->isAlive()) {
-            it = particles.erase(it);
-        } else {
-            ++it;
-        }
+    // 帧时间换算为整数 tick，不足一个 tick 的部分留到下一帧
+    float exactTicks = deltaTime * ParticleStorage::TICKS_PER_SECOND + tickRemainder;
+    float wholeTicks = std::floor(exactTicks);
+    tickRemainder = exactTicks - wholeTicks;
+    std::uint16_t ticks = static_cast<std::uint16_t>(std::min(wholeTicks, 65535.0f));
+    
+    // 每帧只分派一次，之后的循环针对具体行为编译
+    switch (behavior) {
+        case ParticleBehavior::Fire:
+            updateParticles<FireBehavior>(deltaTime, ticks);
+            break;
+        case ParticleBehavior::Ice:
+            updateParticles<IceBehavior>(deltaTime, ticks);
+            break;
+        case ParticleBehavior::Electric:
+            updateParticles<ElectricBehavior>(deltaTime, ticks);
+            break;
+        default:
+            updateParticles<DefaultBehavior>(deltaTime, ticks);
+            break;
     }
 }
 
-void ParticleSystem::draw(sf::RenderWindow& window) const {
-    // 绘制所有粒子
-    for (const auto& particle : particles) {
-        particle->draw(window);
+template <typename Behavior>
+void ParticleSystem::updateParticles(float deltaTime, std::uint16_t ticks) {
+    // 整块推进生命周期（SIMD内核），默认行为同时按速度移动
+    if (Behavior::USES_VELOCITY) {
+        ParticleKernel::integrate(particles, deltaTime, ticks);
+    } else {
+        ParticleKernel::fade(particles, ticks);
+    }
+    
+    removeDeadParticles();
+    
+    // 统一参数每帧计算一次，逐粒子只做位置更新
+    const typename Behavior::Frame frame = Behavior::prepare(deltaTime, behaviorPhase);
+    for (std::size_t i = 0; i < particles.size(); i++) {
+        Behavior::apply(particles.positions[i], particles.getLifeRatio(i), frame);
+    }
+    
+    updateBounds();
+}
+
+void ParticleSystem::updateBounds() {
+    // 发射中的系统包含发射区域，即使暂时没有粒子
+    if (particles.empty()) {
+        bounds = isEmitting ? getEmitterBounds() : sf::FloatRect(emitterConfig.position, sf::Vector2f(0, 0));
+        return;
+    }
+    
+    float minX = particles.positions[0].x;
+    float maxX = minX;
+    float minY = particles.positions[0].y;
+    float maxY = minY;
+    for (std::size_t i = 1; i < particles.size(); i++) {
+        const sf::Vector2f& position = particles.positions[i];
+        minX = std::min(minX, position.x);
+        maxX = std::max(maxX, position.x);
+        minY = std::min(minY, position.y);
+        maxY = std::max(maxY, position.y);
+    }
+    
+    // 粒子绘制为边长 2 * size 的方块，size 不超过最大尺寸
+    float radius = emitterConfig.maxSize;
+    bounds = sf::FloatRect(minX - radius, minY - radius,
+                           maxX - minX + 2 * radius, maxY - minY + 2 * radius);
+    
+    if (isEmitting) {
+        bounds = mergeRects(bounds, getEmitterBounds());
+    }
+}
+
+sf::FloatRect ParticleSystem::getEmitterBounds() const {
+    sf::Vector2f extent(std::abs(emitterConfig.positionVariance.x) + emitterConfig.maxSize,
+                        std::abs(emitterConfig.positionVariance.y) + emitterConfig.maxSize);
+    return sf::FloatRect(emitterConfig.position - extent, extent * 2.0f);
+}
+
+void ParticleSystem::removeDeadParticles() {
+    // 用最后一个粒子填补空位
+    std::size_t i = 0;
+    while (i < particles.size()) {
+        if (particles.lifetimes[i] == 0) {
+            particles.swapRemove(i);
+        } else {
+            ++i;
+        }
     }
 }
 
@@ -119,6 +222,30 @@ void ParticleSystem::clear() {
     particles.clear();
 }
 
+void ParticleSystem::reset() {
+    particles.clear();
+    emitterConfig = EmitterConfig();
+    isEmitting = false;
+    emissionTimer = 0.0f;
+    tickRemainder = 0.0f;
+    emissionScale = 1.0f;
+    minSizeScale = 1.0f;
+    behavior = ParticleBehavior::Default;
+    behaviorPhase = 0.0f;
+    bounds = sf::FloatRect();
+}
+
+void ParticleSystem::reserve(std::size_t count) {
+    particles.reserve(count);
+    
+    // 速度的两个分量一次生成，需要两倍空间
+    randomBuffer.reserve(count * 2);
+}
+
+void ParticleSystem::seed(std::uint64_t value) {
+    randomStream.seed(value);
+}
+
 bool ParticleSystem::hasActiveParticles() const {
     return !particles.empty();
 }
@@ -127,28 +254,55 @@ int ParticleSystem::getActiveParticleCount() const {
     return static_cast<int>(particles.size());
 }
 
-void ParticleSystem::setParticleUpdater(std::function<void(Particle&, float)> updater) {
-    particleUpdater = updater;
+void ParticleSystem::setEmissionScale(float scale) {
+    emissionScale = scale;
 }
 
-void ParticleSystem::setEmitterPosition(const sf::Vector2f& position) {
-    emitterConfig.position = position;
+void ParticleSystem::setMinSizeScale(float scale) {
+    minSizeScale = scale;
 }
 
-std::unique_ptr<Particle> ParticleSystem::createParticle() {
-    return std::make_unique<Particle>();
+int ParticleSystem::evict(int count) {
+    int evicted = 0;
+    
+    // 先淘汰已经在淡出的粒子，视觉影响最小；仍然不够时每次把剩余寿命的门槛加倍，
+    // 优先淘汰快要消失的粒子，保留发射器附近新发射的粒子（门槛超过寿命上限时所有粒子都可淘汰）
+    std::uint32_t threshold = std::max<std::uint32_t>(ParticleStorage::FADE_TICKS, 1);
+    while (evicted < count && !particles.empty()) {
+        std::size_t i = 0;
+        while (evicted < count && i < particles.size()) {
+            if (particles.lifetimes[i] < threshold) {
+                particles.swapRemove(i);
+                evicted++;
+            } else {
+                ++i;
+            }
+        }
+        threshold *= 2;
+    }
+    
+    if (evicted > 0) {
+        updateBounds();
+    }
+    return evicted;
 }
 
-float ParticleSystem::randomFloat(float min, float max) const {
-    std::uniform_real_distribution<float> dist(min, max);
-    return dist(randomEngine);
+void ParticleSystem::setBehavior(ParticleBehavior newBehavior) {
+    behavior = newBehavior;
 }
 
-sf::Color ParticleSystem::randomColor(const sf::Color& min, const sf::Color& max) const {
-    return sf::Color(
-        static_cast<sf::Uint8>(randomFloat(min.r, max.r)),
-        static_cast<sf::Uint8>(randomFloat(min.g, max.g)),
-        static_cast<sf::Uint8>(randomFloat(min.b, max.b)),
-        static_cast<sf::Uint8>(randomFloat(min.a, max.a))
-    );
+void ParticleSystem::setBehaviorPhase(float phase) {
+    behaviorPhase = phase;
+}
+
+void ParticleSystem::setEmitterPosition(const sf::Vector2f& position) {
+    emitterConfig.position = position;
+}
+
+const float* ParticleSystem::randomColumn(std::size_t count, float min, float max) {
+    if (randomBuffer.size() < count) {
+        randomBuffer.resize(count);
+    }
+    randomStream.fill(randomBuffer.data(), count, min, max);
+    return randomBuffer.data();
 }
\ No newline at end of file
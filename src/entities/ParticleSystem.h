@@ -3,11 +3,11 @@
 
 #include <SFML/Graphics.hpp>
 #include <vector>
-#include <memory>
-#include <functional>
-#include <random>
+#include <cstdint>
 #include <algorithm>
 #include "Particle.h"
+#include "ParticleBehavior.h"
+#include "../utils/RandomService.h"
 
 class ParticleSystem {
 public:
@@ -43,7 +43,7 @@ public:
     // 设置发射器配置
     void setEmitter(const EmitterConfig& config);
     
-    // 发射一批粒子
+    // 发射一批粒子（一次性预留空间，批量初始化）
     void burst(int count);
     
     // 开始持续发射
@@ -52,34 +52,64 @@ public:
     // 停止发射
     void stop();
     
+    // 是否正在持续发射
+    bool isEmitterRunning() const { return isEmitting; }
+    
     // 更新粒子系统
     void update(float deltaTime);
     
-    // 绘制所有粒子
-    void draw(sf::RenderWindow& window) const;
-    
     // 清除所有粒子
     void clear();
     
+    // 恢复初始状态（清除粒子、配置和行为，保留已分配的内存）
+    void reset();
+    
+    // 预留粒子内存
+    void reserve(std::size_t count);
+    
+    // 设置随机种子（每个系统独立的随机序列，多线程更新时结果可复现）
+    void seed(std::uint64_t value);
+    
     // 检查是否还有活跃粒子
     bool hasActiveParticles() const;
     
     // 获取活跃粒子数量
     int getActiveParticleCount() const;
     
-    // 设置自定义粒子更新函数
-    void setParticleUpdater(std::function<void(Particle&, float)> updater);
+    // 获取粒子数据（供批量渲染读取）
+    const ParticleStorage& getParticles() const { return particles; }
+    
+    // 所有粒子（含半径）和发射区域的包围盒，每次更新和发射后刷新
+    const sf::FloatRect& getBounds() const { return bounds; }
+    
+    // 新粒子可能出现的区域（发射位置 ± 位置变化范围，含最大半径）
+    sf::FloatRect getEmitterBounds() const;
+    
+    // 设置粒子行为（更新循环按行为类型实例化，逐粒子调用被内联）
+    void setBehavior(ParticleBehavior behavior);
+    
+    // 设置行为相位（例如电弧效果跟随障碍物的脉冲时间）
+    void setBehaviorPhase(float phase);
     
     // 设置发射器位置
     void setEmitterPosition(const sf::Vector2f& position);
     
+    // 设置持续发射速率的缩放（粒子预算紧张时降低，0 表示暂停持续发射）
+    void setEmissionScale(float scale);
+    
+    // 设置新粒子最小尺寸的缩放（低画质时缩小粒子以减少填充）
+    void setMinSizeScale(float scale);
+    
+    // 淘汰最多 count 个粒子（优先淘汰正在淡出、剩余寿命短的），返回实际淘汰数量
+    int evict(int count);
+    
     // 获取发射器配置
     EmitterConfig& getEmitterConfig() { return emitterConfig; }
     const EmitterConfig& getEmitterConfig() const { return emitterConfig; }
     
 private:
-    // 粒子池
-    std::vector<std::unique_ptr<Particle>> particles;
+    // 粒子数据（SoA连续存储，死亡粒子交换删除）
+    ParticleStorage particles;
     
     // 发射器配置
     EmitterConfig emitterConfig;
@@ -88,20 +118,36 @@ private:
     bool isEmitting;
     float emissionTimer;
     
-    // 随机数生成器
-    mutable std::mt19937 randomEngine;
+    // 帧时间换算为 tick 后的余数
+    float tickRemainder;
+    float emissionScale;
+    float minSizeScale;
+    
+    // 随机数生成器（默认种子取自 RandomChannel::Particles 子流）
+    RandomStream randomStream;
+    
+    // 批量生成随机数的缓冲区（按最大粒子数的两倍预留）
+    std::vector<float> randomBuffer;
+    
+    // 粒子行为
+    ParticleBehavior behavior;
+    float behaviorPhase;
+    
+    // 包围盒（视锥剔除使用）
+    sf::FloatRect bounds;
     
-    // 自定义更新器
-    std::function<void(Particle&, float)> particleUpdater;
+    // 按行为策略更新所有粒子
+    template <typename Behavior>
+    void updateParticles(float deltaTime, std::uint16_t ticks);
     
-    // 创建新粒子
-    std::unique_ptr<Particle> createParticle();
+    // 移除死亡粒子（交换删除）
+    void removeDeadParticles();
     
-    // 随机浮点数生成器
-    float randomFloat(float min, float max) const;
+    // 重新计算包围盒
+    void updateBounds();
     
-    // 随机颜色生成器
-    sf::Color randomColor(const sf::Color& min, const sf::Color& max) const;
+    // 为 count 个新粒子批量生成一列 [min, max) 的随机数，返回缓冲区
+    const float* randomColumn(std::size_t count, float min, float max);
 };
 
 #endif
\ No newline at end of file
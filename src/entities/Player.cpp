@@ -1,10 +1,10 @@
 #include "Player.h"
 #include "Bullet.h"
-#include <iostream>
-#include <cstdlib> // 为了 rand() 函数
+#include "../utils/Logger.h"
+#include "../utils/RandomService.h"
 
-Player::Player() 
-    : bulletsFired(0), maxBulletUses(3), shootCooldown(0.0f), cooldownTime(0.5f), 
+Player::Player(EntityRegistry& registry)
+    : registry(registry), bulletsFired(0), maxBulletUses(3), shootCooldown(0.0f), cooldownTime(0.5f), 
       shootFeedbackTimer(0.0f), eyeAnimationTimer(0.0f), eyesClosed(false) {
     
     // 初始化主形状
@@ -15,18 +15,6 @@ Player::Player()
     
     originalColor = shape.getFillColor();
     
-    // 初始化左眼
-    leftEye.setRadius(6.0f);
-    leftEye.setFillColor(sf::Color::Black);
-    leftEye.setOutlineColor(sf::Color::White);
-    leftEye.setOutlineThickness(1.0f);
-    
-    // 初始化右眼
-    rightEye.setRadius(6.0f);
-    rightEye.setFillColor(sf::Color::Black);
-    rightEye.setOutlineColor(sf::Color::White);
-    rightEye.setOutlineThickness(1.0f);
-    
     reset();
 }
 
@@ -36,40 +24,23 @@ Player::~Player() {
 
 void Player::reset() {
     shape.setPosition(Config::PLAYER_START_X, Config::PLAYER_START_Y);
+    previousPosition = shape.getPosition();
     velocity = sf::Vector2f(0, 0);
-    bullets.clear();
     bulletsFired = 0;  // 重置已发射子弹数
     shootCooldown = 0.0f;
     shootFeedbackTimer = 0.0f;
     eyeAnimationTimer = 0.0f;
     eyesClosed = false;
     shape.setFillColor(originalColor);
-    
-    // 更新眼睛位置
-    updateEyesPosition();
 }
 
-void Player::update(float deltaTime) {
-    handleInput(deltaTime);
+void Player::update(float deltaTime, const PlayerInput& input) {
+    handleInput(input);
     applyConstraints();
     
     // 更新位置
     shape.move(velocity * deltaTime);
     
-    // 更新子弹
-    for (auto& bullet : bullets) {
-        bullet->update(deltaTime);
-    }
-    
-    // 移除离开屏幕或应该被移除的子弹
-    bullets.erase(
-        std::remove_if(bullets.begin(), bullets.end(),
-            [](const std::unique_ptr<Bullet>& b) {
-                return b->isOffScreen() || b->shouldRemove();
-            }),
-        bullets.end()
-    );
-    
     // 更新射击冷却
     if (shootCooldown > 0) {
         shootCooldown -= deltaTime;
@@ -85,65 +56,41 @@ void Player::update(float deltaTime) {
     
     // 更新眼睛动画
     updateEyesAnimation(deltaTime);
-    updateEyesPosition();
 }
 
-void Player::draw(sf::RenderWindow& window) {
-    // 先绘制玩家主体
-    window.draw(shape);
-    
-    // 绘制眼睛（如果眼睛没有闭合）
-    if (!eyesClosed) {
-        window.draw(leftEye);
-        window.draw(rightEye);
-    } else {
-        // 绘制闭合的眼睛（两条线）
-        drawClosedEyes(window);
-    }
-    
-    // 绘制子弹（在玩家上面）
-    for (auto& bullet : bullets) {
-        bullet->draw(window);
-    }
-    
-    // 绘制射击反馈（射击时发光）
-    if (shootFeedbackTimer > 0) {
-        float intensity = shootFeedbackTimer / 0.15f;
-        sf::RectangleShape feedbackShape(shape);
-        feedbackShape.setFillColor(sf::Color(255, 255, 255, static_cast<sf::Uint8>(100 * intensity)));
-        feedbackShape.setOutlineColor(sf::Color(255, 255, 255, static_cast<sf::Uint8>(200 * intensity)));
-        window.draw(feedbackShape);
-    }
+void Player::writeSnapshot(PlayerSnapshot& snapshot) const {
+    snapshot.position = shape.getPosition();
+    snapshot.previousPosition = previousPosition;
+    snapshot.fillColor = shape.getFillColor();
+    snapshot.shootFeedback = shootFeedbackTimer > 0 ? shootFeedbackTimer / 0.15f : 0.0f;
+    snapshot.eyesClosed = eyesClosed;
+    snapshot.remainingBullets = getRemainingBullets();
 }
 
-void Player::handleInput(float deltaTime) {
+void Player::handleInput(const PlayerInput& input) {
     velocity.x = 0;
     velocity.y = 0;
     
     // 左右移动
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left) ||
-        sf::Keyboard::isKeyPressed(sf::Keyboard::A)) {
+    if (input.left) {
         velocity.x = -Config::PLAYER_SPEED;
     }
     
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right) ||
-        sf::Keyboard::isKeyPressed(sf::Keyboard::D)) {
+    if (input.right) {
         velocity.x = Config::PLAYER_SPEED;
     }
     
     // 上下移动（新增）
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up) ||
-        sf::Keyboard::isKeyPressed(sf::Keyboard::W)) {
+    if (input.up) {
         velocity.y = -Config::PLAYER_SPEED;
     }
     
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down) ||
-        sf::Keyboard::isKeyPressed(sf::Keyboard::S)) {
+    if (input.down) {
         velocity.y = Config::PLAYER_SPEED;
     }
     
     // 发射子弹（空格键）- 最多只能发射3次
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space) && 
+    if (input.shoot && 
         shootCooldown <= 0 && 
         bulletsFired < maxBulletUses) {
         if (shoot()) {
@@ -181,7 +128,7 @@ sf::FloatRect Player::getBounds() const {
 bool Player::shoot() {
     // 检查是否已达到最大发射次数
     if (bulletsFired >= maxBulletUses) {
-        std::cout << "No bullets remaining!" << std::endl;
+        LOG_DEBUG(LogCategory::Player, "No bullets remaining!");
         return false;
     }
     
@@ -189,7 +136,9 @@ bool Player::shoot() {
     float bulletX = shape.getPosition().x + shape.getSize().x / 2.0f;
     float bulletY = shape.getPosition().y - 10.0f; // 从玩家上方发射
     
-    bullets.push_back(std::make_unique<Bullet>(bulletX, bulletY));
+    if (!Bullet::spawn(registry, bulletX, bulletY).isValid()) {
+        return false;
+    }
     bulletsFired++;  // 增加已发射子弹计数
     
     // 射击反馈效果
@@ -200,34 +149,19 @@ bool Player::shoot() {
     eyeAnimationTimer = 0.1f;
     eyesClosed = true;
     
-    std::cout << "Bullet fired! (" << bulletsFired << "/" << maxBulletUses << " bullets used)" << std::endl;
+    LOG_INFO(LogCategory::Player, "Bullet fired! (%d/%d bullets used)", bulletsFired, maxBulletUses);
     
     return true;
 }
 
-void Player::updateEyesPosition() {
-    sf::Vector2f playerPos = shape.getPosition();
-    sf::Vector2f playerSize = shape.getSize();
-    
-    // 左眼位置（左上角）
-    leftEye.setPosition(
-        playerPos.x + playerSize.x * 0.25f - leftEye.getRadius(),
-        playerPos.y + playerSize.y * 0.3f - leftEye.getRadius()
-    );
-    
-    // 右眼位置（右上角）
-    rightEye.setPosition(
-        playerPos.x + playerSize.x * 0.75f - rightEye.getRadius(),
-        playerPos.y + playerSize.y * 0.3f - rightEye.getRadius()
-    );
-}
-
 void Player::updateEyesAnimation(float deltaTime) {
     if (eyesClosed) {
         eyeAnimationTimer -= deltaTime;
         if (eyeAnimationTimer <= 0) {
             eyesClosed = false;
-            eyeAnimationTimer = 3.0f + (rand() % 10) / 10.0f; // 随机3-4秒后再次眨眼
+            // 随机3-4秒后再次眨眼
+            RandomStream& random = RandomService::getInstance().stream(RandomChannel::Player);
+            eyeAnimationTimer = 3.0f + random.rangeInt(0, 9) / 10.0f;
         }
     } else {
         eyeAnimationTimer -= deltaTime;
@@ -237,35 +171,3 @@ void Player::updateEyesAnimation(float deltaTime) {
         }
     }
 }
-
-void Player::drawClosedEyes(sf::RenderWindow& window) {
-    sf::Vector2f playerPos = shape.getPosition();
-    sf::Vector2f playerSize = shape.getSize();
-    
-    // 左眼闭合线
-    sf::Vertex leftEyeLine[] = {
-        sf::Vertex(sf::Vector2f(
-            playerPos.x + playerSize.x * 0.25f - leftEye.getRadius(),
-            playerPos.y + playerSize.y * 0.3f
-        ), sf::Color::Black),
-        sf::Vertex(sf::Vector2f(
-            playerPos.x + playerSize.x * 0.25f + leftEye.getRadius(),
-            playerPos.y + playerSize.y * 0.3f
-        ), sf::Color::Black)
-    };
-    
-    // 右眼闭合线
-    sf::Vertex rightEyeLine[] = {
-        sf::Vertex(sf::Vector2f(
-            playerPos.x + playerSize.x * 0.75f - rightEye.getRadius(),
-            playerPos.y + playerSize.y * 0.3f
-        ), sf::Color::Black),
-        sf::Vertex(sf::Vector2f(
-            playerPos.x + playerSize.x * 0.75f + rightEye.getRadius(),
-            playerPos.y + playerSize.y * 0.3f
-        ), sf::Color::Black)
-    };
-    
-    window.draw(leftEyeLine, 2, sf::Lines);
-    window.draw(rightEyeLine, 2, sf::Lines);
-}
\ No newline at end of file
@@ -2,19 +2,41 @@
 #define PLAYER_H
 
 #include <SFML/Graphics.hpp>
-#include <vector>
-#include <memory>
 #include "../core/Config.h"
+#include "../core/EntityRegistry.h"
 
-class Bullet; // 前向声明
+// 一次模拟更新时按住的按键（由输入事件维护，模拟线程不直接读取键盘）
+struct PlayerInput {
+    bool left = false;
+    bool right = false;
+    bool up = false;
+    bool down = false;
+    bool shoot = false;
+};
+
+// 绘制玩家所需的状态（由模拟线程写入渲染快照）
+struct PlayerSnapshot {
+    sf::Vector2f position;
+    sf::Vector2f previousPosition;  // 上一次模拟更新后的位置，绘制时插值
+    sf::Color fillColor;
+    float shootFeedback = 0.0f;     // 射击反馈强度（0 - 1）
+    bool eyesClosed = false;
+    int remainingBullets = 0;
+};
 
 class Player {
 public:
-    Player();
+    // 发射的子弹作为实体加入注册表，由实体系统统一更新和绘制
+    explicit Player(EntityRegistry& registry);
     ~Player();  // 添加析构函数声明
     
-    void update(float deltaTime);
-    void draw(sf::RenderWindow& window);
+    void update(float deltaTime, const PlayerInput& input);
+    
+    // 写入绘制所需的状态
+    void writeSnapshot(PlayerSnapshot& snapshot) const;
+    
+    // 记录当前位置，绘制时在它和下一次更新后的位置之间插值
+    void storePreviousPosition() { previousPosition = shape.getPosition(); }
     
     void reset();
     
@@ -23,8 +45,6 @@ public:
     
     // 子弹相关
     bool shoot();  // 返回是否成功发射
-    const std::vector<std::unique_ptr<Bullet>>& getBullets() const { return bullets; }
-    int getBulletCount() const { return bullets.size(); }
     int getRemainingBullets() const { return maxBulletUses - bulletsFired; }  // 获取剩余子弹数
     int getTotalBulletsFired() const { return bulletsFired; }  // 获取已发射子弹数
     bool hasBulletsRemaining() const { return bulletsFired < maxBulletUses; }  // 检查是否有剩余子弹
@@ -34,19 +54,16 @@ public:
 private:
     sf::RectangleShape shape;
     sf::Vector2f velocity;
-    
-    // 眼睛形状
-    sf::CircleShape leftEye;
-    sf::CircleShape rightEye;
+    sf::Vector2f previousPosition;  // 上一次模拟更新后的位置
     
     // 子弹相关
-    std::vector<std::unique_ptr<Bullet>> bullets;
+    EntityRegistry& registry;
     int bulletsFired;          // 已发射的子弹总数
     int maxBulletUses;         // 最大子弹使用次数（3次）
     float shootCooldown;
     float cooldownTime;
     
-    void handleInput(float deltaTime);
+    void handleInput(const PlayerInput& input);
     void applyConstraints();
     
     // 视觉反馈
@@ -57,10 +74,7 @@ private:
     float eyeAnimationTimer;
     bool eyesClosed;
     
-    // 新增：眼睛相关函数声明
-    void updateEyesPosition();
     void updateEyesAnimation(float deltaTime);
-    void drawClosedEyes(sf::RenderWindow& window);
 };
 
 #endif
\ No newline at end of file
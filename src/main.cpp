@@ -1,8 +1,84 @@
 #include "core/Game.h"
+#include "core/Headless.h"
+#include "utils/AllocationCounter.h"
+#include "utils/Logger.h"
+#include "utils/Tracer.h"
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
 
-int main() {
+namespace {
+    void printUsage(const char* program) {
+        std::cerr << "Usage: " << program << " [--trace] [--headless [--ticks N] [--seed N] [--script FILE]]" << std::endl;
+    }
+
+    // 无窗口运行并输出统计
+    int runHeadlessMode(const HeadlessOptions& options) {
+        HeadlessResult result = runHeadless(options);
+        if (!result.ok) {
+            return 1;
+        }
+
+        // 先写出运行中的日志，统计输出在最后
+        Logger::getInstance().flush();
+
+        std::cout << "===========================================" << std::endl;
+        std::cout << "Headless run finished" << std::endl;
+        std::cout << "Ticks: " << result.ticks << " in " << result.seconds << "s ("
+                  << (result.seconds > 0.0 ? result.ticks / result.seconds : 0.0) << " ticks/s)" << std::endl;
+        std::cout << "Games finished: " << result.gamesFinished
+                  << ", best score: " << result.bestScore
+                  << ", final score: " << result.finalScore << std::endl;
+        std::cout << "Rendered entities: " << result.renderedEntities
+                  << ", particles: " << result.renderedParticles << std::endl;
+        if (AllocationCounter::isEnabled()) {
+            std::cout << "Heap allocations during update: " << result.updateAllocations << std::endl;
+        } else {
+            std::cout << "Heap allocations during update: n/a (build with SIMPLERUNNER_TRACK_ALLOCATIONS)" << std::endl;
+        }
+        std::cout << "===========================================" << std::endl;
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    bool headless = false;
+    bool trace = false;
+    HeadlessOptions options;
+    
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (std::strcmp(argv[i], "--trace") == 0) {
+            trace = true;
+        } else if (std::strcmp(argv[i], "--ticks") == 0 && hasValue) {
+            options.ticks = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--script") == 0 && hasValue) {
+            options.scriptPath = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    
+    // 从启动开始记录时间线：窗口模式退出时写出（F4 也可以随时开始/停止），无窗口模式运行结束时写出
+    Tracer::setThreadName("main");
+    if (trace) {
+        Tracer::start();
+    }
+    
     try {
+        if (headless) {
+            int status = runHeadlessMode(options);
+            if (Tracer::isEnabled()) {
+                Tracer::stop(Config::TRACE_FILE_PREFIX + ".json");
+            }
+            return status;
+        }
+        
         Game game;
         game.run();
     }
@@ -12,4 +88,4 @@ int main() {
     }
     
     return 0;
-}
\ No newline at end of file
+}
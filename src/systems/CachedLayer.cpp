@@ -0,0 +1,49 @@
+#include "CachedLayer.h"
+#include "../utils/Logger.h"
+#include <cmath>
+
+const sf::BlendMode CachedLayer::PREMULTIPLIED_ALPHA(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+
+CachedLayer::CachedLayer(const sf::FloatRect& area)
+    : area(area), status(Status::NotCreated), valid(false), key(0) {
+}
+
+int CachedLayer::draw(sf::RenderTarget& target, int inputKey, const Builder& build) {
+    if (status == Status::NotCreated) {
+        status = create() ? Status::Ready : Status::Unsupported;
+    }
+    
+    // 没有渲染纹理：每帧重新绘制（绘制调用次数按 1 计）
+    if (status == Status::Unsupported) {
+        build(target);
+        return 1;
+    }
+    
+    if (!valid || inputKey != key) {
+        texture.clear(sf::Color::Transparent);
+        build(texture);
+        texture.display();
+        key = inputKey;
+        valid = true;
+    }
+    
+    target.draw(sprite, sf::RenderStates(PREMULTIPLIED_ALPHA));
+    return 1;
+}
+
+bool CachedLayer::create() {
+    unsigned int width = static_cast<unsigned int>(std::ceil(area.width));
+    unsigned int height = static_cast<unsigned int>(std::ceil(area.height));
+    if (!texture.create(width, height)) {
+        LOG_WARNING(LogCategory::Render, "Render texture %ux%u unavailable, static layer drawn every frame",
+                    width, height);
+        return false;
+    }
+    
+    // 纹理中使用窗口坐标，精灵放回原来的位置
+    texture.setView(sf::View(sf::FloatRect(area.left, area.top,
+                                           static_cast<float>(width), static_cast<float>(height))));
+    sprite.setTexture(texture.getTexture(), true);
+    sprite.setPosition(area.left, area.top);
+    return true;
+}
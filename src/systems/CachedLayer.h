@@ -0,0 +1,39 @@
+#ifndef CACHED_LAYER_H
+#define CACHED_LAYER_H
+
+#include <SFML/Graphics.hpp>
+#include <functional>
+
+// 缓存的静态图层
+// 不变的界面内容（文字、框、装饰）只在第一次绘制或输入改变时画到渲染纹理中，
+// 之后每帧只绘制一个精灵。输入用一个整数表示（例如是否绘制文字阴影），改变时重新生成。
+// 图层覆盖窗口中的一块区域，生成时仍使用窗口坐标；不支持渲染纹理时每帧直接绘制到窗口。
+class CachedLayer {
+public:
+    using Builder = std::function<void(sf::RenderTarget&)>;
+
+    explicit CachedLayer(const sf::FloatRect& area);
+
+    // 返回绘制调用次数
+    int draw(sf::RenderTarget& target, int inputKey, const Builder& build);
+
+    // 下一次绘制时重新生成（例如字体改变）
+    void invalidate() { valid = false; }
+
+private:
+    enum class Status { NotCreated, Ready, Unsupported };
+
+    sf::FloatRect area;
+    sf::RenderTexture texture;
+    sf::Sprite sprite;
+    Status status;
+    bool valid;
+    int key;
+
+    // 纹理中保存的是预乘透明度的颜色，绘制时不再乘一次透明度
+    static const sf::BlendMode PREMULTIPLIED_ALPHA;
+
+    bool create();
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include "CollisionSystem.h"
+
+void CollisionSystem::reserve(std::size_t capacity) {
+    grid.reserve(capacity);
+    proxyBounds.reserve(capacity);
+    proxyEntities.reserve(capacity);
+    proxyLayers.reserve(capacity);
+    proxyConsumed.reserve(capacity);
+}
+
+void CollisionSystem::update(const EntityRegistry& registry) {
+    proxyBounds.clear();
+    proxyEntities.clear();
+    proxyLayers.clear();
+
+    const Collider* colliders = registry.colliders.data();
+    const Entity* entities = registry.colliders.entities();
+    std::size_t count = registry.colliders.size();
+
+    for (std::size_t i = 0; i < count; i++) {
+        const Transform& transform = registry.transforms.get(entities[i]);
+        proxyBounds.push_back(colliders[i].getBounds(transform));
+        proxyEntities.push_back(entities[i]);
+        proxyLayers.push_back(colliders[i].layer);
+    }
+    proxyConsumed.assign(count, 0);
+
+    grid.build(proxyBounds);
+}
+
+void CollisionSystem::findContacts(const EntityRegistry& registry, CollisionLayer layer,
+                                   CollisionLayer targetLayer, std::vector<Contact>& contacts) {
+    contacts.clear();
+
+    for (std::uint32_t id = 0; id < proxyBounds.size(); id++) {
+        if (!isCandidate(registry, id, layer)) continue;
+
+        // 网格返回的顺序不固定，取编号最小的目标，结果与逐个检测一致
+        std::uint32_t target = NONE;
+        grid.query(proxyBounds[id], [&](std::uint32_t other) {
+            if (other < target && other != id && !proxyConsumed[other] &&
+                isCandidate(registry, other, targetLayer)) {
+                target = other;
+            }
+        });
+
+        if (target != NONE) {
+            proxyConsumed[target] = 1;
+            contacts.push_back({ proxyEntities[id], proxyEntities[target] });
+        }
+    }
+}
+
+Entity CollisionSystem::findFirstOverlap(const EntityRegistry& registry, const sf::FloatRect& bounds,
+                                         CollisionLayer targetLayer) {
+    std::uint32_t target = NONE;
+    grid.query(bounds, [&](std::uint32_t other) {
+        if (other < target && isCandidate(registry, other, targetLayer)) {
+            target = other;
+        }
+    });
+
+    return target != NONE ? proxyEntities[target] : Entity();
+}
+
+void CollisionSystem::queryRadius(const EntityRegistry& registry, const sf::Vector2f& center, float radius,
+                                  CollisionLayer targetLayer, std::vector<Entity>& results) {
+    results.clear();
+    grid.queryRadius(center, radius, [&](std::uint32_t other) {
+        if (isCandidate(registry, other, targetLayer)) {
+            results.push_back(proxyEntities[other]);
+        }
+    });
+}
@@ -0,0 +1,59 @@
+#ifndef COLLISION_SYSTEM_H
+#define COLLISION_SYSTEM_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+#include "../core/EntityRegistry.h"
+#include "SpatialHash.h"
+
+// 碰撞系统
+// 每帧在移动和移除之后调用 update()：线性遍历碰撞组件数组，
+// 把所有包围盒收集到连续的缓冲区中，并重建空间哈希网格。
+// 之后的所有碰撞查询都经过网格，只检测附近的实体。
+// 本帧内被销毁或移除碰撞组件的实体（例如被击碎的障碍物）在查询时自动跳过。
+class CollisionSystem {
+public:
+    // 预留缓冲区容量（实体数量不超过该值时不分配内存）
+    void reserve(std::size_t capacity);
+
+    // 收集碰撞盒并重建网格
+    void update(const EntityRegistry& registry);
+
+    // 一次接触（first 属于查询层，second 属于目标层）
+    struct Contact {
+        Entity first;
+        Entity second;
+    };
+
+    // 为 layer 中的每个实体找出第一个碰到的 targetLayer 实体
+    // 每个目标在一次 update() 之后最多被命中一次（同一帧两颗子弹不会重复击碎同一个障碍物）
+    void findContacts(const EntityRegistry& registry, CollisionLayer layer, CollisionLayer targetLayer,
+                      std::vector<Contact>& contacts);
+
+    // 找出第一个与 bounds 相交的 targetLayer 实体（没有时返回无效实体）
+    Entity findFirstOverlap(const EntityRegistry& registry, const sf::FloatRect& bounds,
+                            CollisionLayer targetLayer);
+
+    // 找出碰撞盒与圆相交的所有 targetLayer 实体（顺序不固定）
+    void queryRadius(const EntityRegistry& registry, const sf::Vector2f& center, float radius,
+                     CollisionLayer targetLayer, std::vector<Entity>& results);
+
+private:
+    static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+    SpatialHash grid;
+
+    // 按收集顺序（碰撞组件数组顺序）排列，下标即网格中的元素编号
+    std::vector<sf::FloatRect> proxyBounds;
+    std::vector<Entity> proxyEntities;
+    std::vector<CollisionLayer> proxyLayers;
+    std::vector<std::uint8_t> proxyConsumed;
+
+    // 实体仍然存在且仍有碰撞组件，并且属于指定层
+    bool isCandidate(const EntityRegistry& registry, std::uint32_t id, CollisionLayer layer) const {
+        return proxyLayers[id] == layer && registry.colliders.has(proxyEntities[id]);
+    }
+};
+
+#endif
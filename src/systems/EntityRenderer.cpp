@@ -0,0 +1,76 @@
+#include "EntityRenderer.h"
+#include "../entities/Bullet.h"
+#include "../entities/ObstacleParticle.h"
+
+EntityRenderer::EntityRenderer() {
+    // 核心形状（圆形）
+    float coreRadius = ObstacleParticle::CORE_RADIUS;
+    obstacleCore.setRadius(coreRadius);
+    obstacleCore.setOrigin(coreRadius, coreRadius);
+
+    // 外框形状（方形，用于旋转效果）
+    float outlineSize = ObstacleParticle::OUTLINE_SIZE;
+    obstacleOutline.setSize(sf::Vector2f(outlineSize, outlineSize));
+    obstacleOutline.setOrigin(outlineSize / 2, outlineSize / 2);
+    obstacleOutline.setFillColor(sf::Color::Transparent);
+    obstacleOutline.setOutlineThickness(ObstacleParticle::OUTLINE_THICKNESS);
+
+    bullet.setRadius(Bullet::RADIUS);
+    bullet.setOrigin(Bullet::RADIUS, Bullet::RADIUS);
+    bullet.setOutlineThickness(Bullet::OUTLINE_THICKNESS);
+}
+
+int EntityRenderer::draw(sf::RenderTarget& target, const std::vector<EntitySnapshot>& entities,
+                         const sf::FloatRect& viewBounds, RenderShape shape, float interpolation) {
+    int drawCalls = 0;
+    for (const EntitySnapshot& entity : entities) {
+        if (entity.render.shape != shape) continue;
+
+        const Transform transform = entity.transform.interpolate(interpolation);
+        if (!entity.render.getBounds(transform).intersects(viewBounds)) continue;
+
+        switch (shape) {
+            case RenderShape::Obstacle:
+                drawCalls += drawObstacle(target, transform, entity.render);
+                break;
+            case RenderShape::Bullet:
+                drawCalls += drawBullet(target, transform, entity.render, entity.opacity);
+                break;
+        }
+    }
+    return drawCalls;
+}
+
+int EntityRenderer::drawObstacle(sf::RenderTarget& target, const Transform& transform,
+                                 const Render& render) {
+    obstacleOutline.setPosition(transform.position);
+    obstacleOutline.setRotation(-transform.rotation * 0.5f);  // 反向慢速旋转
+    obstacleOutline.setScale(transform.scale, transform.scale);
+    obstacleOutline.setOutlineColor(render.outlineColor);
+
+    obstacleCore.setPosition(transform.position);
+    obstacleCore.setRotation(transform.rotation);
+    obstacleCore.setScale(transform.scale, transform.scale);
+    obstacleCore.setFillColor(render.fillColor);
+
+    target.draw(obstacleOutline);
+    target.draw(obstacleCore);
+    return 2;
+}
+
+int EntityRenderer::drawBullet(sf::RenderTarget& target, const Transform& transform,
+                               const Render& render, float opacity) {
+    // 销毁时的淡出效果
+    if (opacity <= 0.0f) return 0;
+
+    sf::Color fillColor = render.fillColor;
+    sf::Color outlineColor = render.outlineColor;
+    fillColor.a = static_cast<sf::Uint8>(fillColor.a * opacity);
+    outlineColor.a = static_cast<sf::Uint8>(outlineColor.a * opacity);
+
+    bullet.setPosition(transform.position);
+    bullet.setFillColor(fillColor);
+    bullet.setOutlineColor(outlineColor);
+    target.draw(bullet);
+    return 1;
+}
@@ -0,0 +1,34 @@
+#ifndef ENTITY_RENDERER_H
+#define ENTITY_RENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "../core/RenderSnapshot.h"
+
+// 实体渲染器
+// 同一种形状的所有实体共用一组 SFML 形状对象，绘制前写入位置、旋转、缩放和颜色；
+// 实体本身不再各自持有形状（和其中的顶点数组）。
+class EntityRenderer {
+public:
+    EntityRenderer();
+
+    // 绘制与可见区域相交的所有指定形状的实体
+    // interpolation 为上一次与本次模拟更新之间的插值比例（0 - 1）
+    // 返回绘制调用次数
+    int draw(sf::RenderTarget& target, const std::vector<EntitySnapshot>& entities,
+              const sf::FloatRect& viewBounds, RenderShape shape, float interpolation);
+
+private:
+    // 障碍物：核心圆 + 反向旋转的方形外框
+    sf::CircleShape obstacleCore;
+    sf::RectangleShape obstacleOutline;
+
+    // 子弹
+    sf::CircleShape bullet;
+
+    int drawObstacle(sf::RenderTarget& target, const Transform& transform, const Render& render);
+    int drawBullet(sf::RenderTarget& target, const Transform& transform, const Render& render,
+                    float opacity);
+};
+
+#endif
@@ -0,0 +1,107 @@
+#include "EntitySystems.h"
+#include <cmath>
+
+namespace EntitySystems {
+
+void storePreviousTransforms(EntityRegistry& registry) {
+    Transform* transforms = registry.transforms.data();
+    std::size_t count = registry.transforms.size();
+
+    for (std::size_t i = 0; i < count; i++) {
+        transforms[i].storePrevious();
+    }
+}
+
+void updateMovement(EntityRegistry& registry, float deltaTime) {
+    Velocity* velocities = registry.velocities.data();
+    const Entity* entities = registry.velocities.entities();
+    std::size_t count = registry.velocities.size();
+
+    for (std::size_t i = 0; i < count; i++) {
+        Velocity& velocity = velocities[i];
+        Transform& transform = registry.transforms.get(entities[i]);
+
+        transform.position += velocity.linear * deltaTime;
+        if (velocity.swing > 0.0f) {
+            transform.position.x += std::sin(velocity.phase * 2) * velocity.swing * deltaTime;
+        }
+        transform.rotation += velocity.angular * deltaTime;
+
+        velocity.phase += velocity.phaseSpeed * deltaTime;
+        if (velocity.pulse > 0.0f) {
+            transform.scale = velocity.pulse * std::sin(velocity.phase) + 1.0f;
+        }
+    }
+}
+
+void updateLifetimes(EntityRegistry& registry, float deltaTime, std::vector<Entity>& expired) {
+    Lifetime* lifetimes = registry.lifetimes.data();
+    const Entity* entities = registry.lifetimes.entities();
+    std::size_t count = registry.lifetimes.size();
+
+    for (std::size_t i = 0; i < count; i++) {
+        lifetimes[i].elapsed += deltaTime;
+        if (lifetimes[i].elapsed >= lifetimes[i].duration) {
+            expired.push_back(entities[i]);
+        }
+    }
+}
+
+void collectOffscreen(const EntityRegistry& registry, const sf::FloatRect& viewBounds,
+                      std::vector<Entity>& offscreen) {
+    const Velocity* velocities = registry.velocities.data();
+    const Entity* entities = registry.velocities.entities();
+    std::size_t count = registry.velocities.size();
+
+    const float viewRight = viewBounds.left + viewBounds.width;
+    const float viewBottom = viewBounds.top + viewBounds.height;
+
+    for (std::size_t i = 0; i < count; i++) {
+        const Render* render = registry.renders.find(entities[i]);
+        if (!render) continue;
+
+        sf::FloatRect bounds = render->getBounds(registry.transforms.get(entities[i]));
+        const sf::Vector2f& linear = velocities[i].linear;
+
+        if ((linear.y > 0.0f && bounds.top > viewBottom) ||
+            (linear.y < 0.0f && bounds.top + bounds.height < viewBounds.top) ||
+            (linear.x > 0.0f && bounds.left > viewRight) ||
+            (linear.x < 0.0f && bounds.left + bounds.width < viewBounds.left)) {
+            offscreen.push_back(entities[i]);
+        }
+    }
+}
+
+void syncEmitters(const EntityRegistry& registry, ParticlePool& particlePool) {
+    const Emitter* emitters = registry.emitters.data();
+    const Entity* entities = registry.emitters.entities();
+    std::size_t count = registry.emitters.size();
+
+    for (std::size_t i = 0; i < count; i++) {
+        const Transform& transform = registry.transforms.get(entities[i]);
+
+        if (ParticleSystem* trailSystem = particlePool.get(emitters[i].trail)) {
+            trailSystem->setEmitterPosition(transform.position);
+        }
+
+        if (ParticleSystem* auraSystem = particlePool.get(emitters[i].aura)) {
+            auraSystem->setEmitterPosition(transform.position);
+            if (const Velocity* velocity = registry.velocities.find(entities[i])) {
+                auraSystem->setBehaviorPhase(velocity->phase);
+            }
+        }
+    }
+}
+
+void destroyEntity(EntityRegistry& registry, ParticlePool& particlePool, Entity entity) {
+    if (!registry.isAlive(entity)) return;
+
+    if (Emitter* emitter = registry.emitters.find(entity)) {
+        particlePool.release(emitter->trail);
+        particlePool.release(emitter->aura);
+        particlePool.release(emitter->burst);
+    }
+    registry.destroy(entity);
+}
+
+}
@@ -0,0 +1,33 @@
+#ifndef ENTITY_SYSTEMS_H
+#define ENTITY_SYSTEMS_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "../core/EntityRegistry.h"
+#include "ParticlePool.h"
+
+// 实体系统：每个函数顺序遍历一个组件的密集数组
+// 需要销毁的实体先收集到调用者提供的列表中，遍历结束后再统一销毁。
+namespace EntitySystems {
+    // 每次模拟更新开始时记录变换，绘制时用于插值
+    void storePreviousTransforms(EntityRegistry& registry);
+
+    // 移动：位置、旋转、水平摆动和缩放脉冲
+    void updateMovement(EntityRegistry& registry, float deltaTime);
+
+    // 寿命计时，收集到期的实体
+    void updateLifetimes(EntityRegistry& registry, float deltaTime, std::vector<Entity>& expired);
+
+    // 收集沿运动方向完全离开可见区域的实体
+    // 只看运动方向：从上方生成、还没有进入可见区域的障碍物不会被移除
+    void collectOffscreen(const EntityRegistry& registry, const sf::FloatRect& viewBounds,
+                          std::vector<Entity>& offscreen);
+
+    // 把发射器位置和相位同步到借用的粒子系统
+    void syncEmitters(const EntityRegistry& registry, ParticlePool& particlePool);
+
+    // 归还实体借用的粒子系统（剩余粒子由粒子池继续播放）并销毁实体
+    void destroyEntity(EntityRegistry& registry, ParticlePool& particlePool, Entity entity);
+}
+
+#endif
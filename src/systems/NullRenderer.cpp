@@ -0,0 +1,19 @@
+#include "NullRenderer.h"
+
+NullRenderer::NullRenderer() : frameCount(0), entityCount(0), particleCount(0) {
+}
+
+void NullRenderer::draw(const RenderSnapshot& snapshot, const sf::FloatRect& viewBounds, float interpolation) {
+    frameCount++;
+
+    if (snapshot.state == GameState::StartScreen) return;
+
+    for (const EntitySnapshot& entity : snapshot.entities) {
+        const Transform transform = entity.transform.interpolate(interpolation);
+        if (entity.render.getBounds(transform).intersects(viewBounds) && entity.opacity > 0.0f) {
+            entityCount++;
+        }
+    }
+
+    particleCount += snapshot.particles.getParticleCount();
+}
@@ -0,0 +1,28 @@
+#ifndef NULL_RENDERER_H
+#define NULL_RENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include "../core/RenderSnapshot.h"
+
+// 空渲染器（无窗口运行时使用）
+// 与窗口渲染读取同样的快照并做同样的可见性剔除，但不调用任何图形接口，
+// 只统计本来会绘制的实体和粒子数量。不需要显示器和 OpenGL 上下文。
+class NullRenderer {
+public:
+    NullRenderer();
+
+    // "绘制"一帧：统计与可见区域相交的实体和快照中的粒子
+    void draw(const RenderSnapshot& snapshot, const sf::FloatRect& viewBounds, float interpolation);
+
+    std::uint64_t getFrameCount() const { return frameCount; }
+    std::uint64_t getEntityCount() const { return entityCount; }      // 累计绘制的实体
+    std::uint64_t getParticleCount() const { return particleCount; }  // 累计绘制的粒子
+
+private:
+    std::uint64_t frameCount;
+    std::uint64_t entityCount;
+    std::uint64_t particleCount;
+};
+
+#endif
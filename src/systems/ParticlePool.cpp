@@ -0,0 +1,262 @@
+#include "ParticlePool.h"
+#include <algorithm>
+
+ParticlePool::ParticlePool(std::size_t systemCount, std::size_t particlesPerSystem)
+    : slots(systemCount), budget(Config::PARTICLE_BUDGET), frameIndex(0),
+      evictedParticles(0), emissionMultiplier(1.0f), minSizeScale(1.0f), auraEnabled(true) {
+    
+    // 默认可见区域为窗口大小（默认视图）
+    setViewBounds(sf::FloatRect(0, 0, Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT));
+
+    freeSlots.reserve(systemCount);
+    activeSlots.reserve(systemCount);
+
+    // 预先分配每个系统的粒子内存，倒序压入使下标小的槽位先被使用
+    for (std::size_t i = systemCount; i-- > 0; ) {
+        slots[i].system.reserve(particlesPerSystem);
+        freeSlots.push_back(static_cast<std::uint32_t>(i));
+    }
+}
+
+ParticleHandle ParticlePool::acquire(ParticleRenderer::Layer layer, ParticlePriority priority) {
+    ParticleHandle handle;
+    if (freeSlots.empty()) {
+        // 池已耗尽：粒子只是装饰效果，直接放弃
+        return handle;
+    }
+    if (priority == ParticlePriority::Aura && !auraEnabled) {
+        return handle;
+    }
+
+    std::uint32_t index = freeSlots.back();
+    freeSlots.pop_back();
+    activeSlots.push_back(index);
+
+    Slot& slot = slots[index];
+    slot.state = SlotState::Leased;
+    slot.layer = layer;
+    slot.priority = priority;
+    slot.pendingTime = 0.0f;
+    slot.system.reset();
+    slot.system.setMinSizeScale(minSizeScale);
+    
+    // 每次借出重新取种子，使同一种子的整局游戏可以重现
+    slot.system.seed(RandomService::getInstance().stream(RandomChannel::Particles).nextU64());
+
+    handle.index = index;
+    handle.generation = slot.generation;
+    return handle;
+}
+
+void ParticlePool::release(ParticleHandle& handle) {
+    ParticleSystem* system = get(handle);
+    if (system) {
+        Slot& slot = slots[handle.index];
+        slot.state = SlotState::Draining;
+
+        // 停止发射，剩余粒子保持原有行为直到消失
+        system->stop();
+    }
+
+    handle = ParticleHandle();
+}
+
+ParticleSystem* ParticlePool::get(const ParticleHandle& handle) {
+    if (!handle.isValid() || handle.index >= slots.size()) return nullptr;
+
+    Slot& slot = slots[handle.index];
+    if (slot.generation != handle.generation || slot.state != SlotState::Leased) {
+        return nullptr;
+    }
+    return &slot.system;
+}
+
+const ParticleSystem* ParticlePool::get(const ParticleHandle& handle) const {
+    return const_cast<ParticlePool*>(this)->get(handle);
+}
+
+int ParticlePool::burst(const ParticleHandle& handle, int count) {
+    ParticleSystem* system = get(handle);
+    if (!system || count <= 0) return 0;
+
+    // 预算不足时先为高优先级的爆发腾出空间
+    int room = budget - getActiveParticleCount();
+    if (room < count) {
+        int priorityLimit = static_cast<int>(slots[handle.index].priority);
+        room += evictParticles(count - std::max(room, 0), priorityLimit);
+    }
+
+    // 单个系统的上限由 burst 自己处理
+    int before = system->getActiveParticleCount();
+    system->burst(std::min(count, std::max(room, 0)));
+    return system->getActiveParticleCount() - before;
+}
+
+void ParticlePool::setViewBounds(const sf::FloatRect& bounds) {
+    const float margin = Config::PARTICLE_CULL_MARGIN;
+    viewBounds = sf::FloatRect(bounds.left - margin, bounds.top - margin,
+                               bounds.width + 2 * margin, bounds.height + 2 * margin);
+}
+
+void ParticlePool::update(float deltaTime) {
+    frameIndex++;
+    applyEmissionThrottle(getActiveParticleCount());
+
+    for (std::uint32_t index : activeSlots) {
+        updateSlot(index, deltaTime);
+    }
+
+    enforceBudget();
+    recycleDrained();
+}
+
+void ParticlePool::update(float deltaTime, ThreadPool& threadPool) {
+    // 粒子较少时线程调度开销大于收益
+    int liveParticles = getActiveParticleCount();
+    if (liveParticles < Config::PARTICLE_PARALLEL_MIN_PARTICLES) {
+        update(deltaTime);
+        return;
+    }
+
+    frameIndex++;
+    applyEmissionThrottle(liveParticles);
+
+    // 每个系统只由一个任务更新，系统之间没有共享的可写状态
+    threadPool.parallelFor(activeSlots.size(), Config::PARTICLE_PARALLEL_GRAIN,
+        [this, deltaTime](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                updateSlot(activeSlots[i], deltaTime);
+            }
+        });
+
+    enforceBudget();
+    recycleDrained();
+}
+
+void ParticlePool::collect(ParticleBatch& batch) const {
+    for (std::uint32_t index : activeSlots) {
+        const Slot& slot = slots[index];
+        if (isVisible(slot.system)) {
+            batch.add(slot.system, slot.layer);
+        }
+    }
+}
+
+void ParticlePool::clear() {
+    while (!activeSlots.empty()) {
+        recycle(activeSlots.size() - 1);
+    }
+}
+
+int ParticlePool::getActiveParticleCount() const {
+    int count = 0;
+    for (std::uint32_t index : activeSlots) {
+        count += slots[index].system.getActiveParticleCount();
+    }
+    return count;
+}
+
+void ParticlePool::updateSlot(std::uint32_t index, float deltaTime) {
+    Slot& slot = slots[index];
+    slot.pendingTime += deltaTime;
+
+    // 不可见的系统降低更新频率，按槽位下标错开，避免集中在同一帧
+    if (!isVisible(slot.system) &&
+        (frameIndex + index) % Config::PARTICLE_OFFSCREEN_UPDATE_INTERVAL != 0) {
+        return;
+    }
+
+    slot.system.update(slot.pendingTime);
+    slot.pendingTime = 0.0f;
+}
+
+void ParticlePool::applyEmissionThrottle(int liveParticles) {
+    // 各优先级开始限流的粒子数，达到预算时持续发射完全停止
+    const float auraStart = budget * Config::PARTICLE_AURA_THROTTLE_START;
+    const float trailStart = budget * Config::PARTICLE_TRAIL_THROTTLE_START;
+
+    for (std::uint32_t index : activeSlots) {
+        Slot& slot = slots[index];
+
+        float start;
+        switch (slot.priority) {
+            case ParticlePriority::Aura:  start = auraStart; break;
+            case ParticlePriority::Trail: start = trailStart; break;
+            default:                      start = static_cast<float>(budget); break;
+        }
+
+        float scale = 1.0f;
+        if (liveParticles >= budget) {
+            scale = slot.priority == ParticlePriority::Collision ? 1.0f : 0.0f;
+        } else if (liveParticles > start) {
+            scale = (budget - liveParticles) / (budget - start);
+        }
+        if (slot.priority == ParticlePriority::Aura && !auraEnabled) {
+            scale = 0.0f;
+        }
+        
+        // 发射区域不可见时暂停装饰性发射（碰撞爆发不受影响）
+        if (slot.priority != ParticlePriority::Collision &&
+            !slot.system.getEmitterBounds().intersects(viewBounds)) {
+            scale = 0.0f;
+        }
+        slot.system.setEmissionScale(scale * emissionMultiplier);
+        slot.system.setMinSizeScale(minSizeScale);
+    }
+}
+
+void ParticlePool::enforceBudget() {
+    int excess = getActiveParticleCount() - budget;
+    if (excess > 0) {
+        evictParticles(excess, PRIORITY_COUNT);
+    }
+}
+
+int ParticlePool::evictParticles(int count, int priorityLimit) {
+    int evicted = 0;
+
+    for (int priority = 0; priority < priorityLimit && evicted < count; priority++) {
+        // 先淘汰已归还系统中的粒子，再淘汰仍在使用中的
+        for (SlotState state : { SlotState::Draining, SlotState::Leased }) {
+            for (std::uint32_t index : activeSlots) {
+                if (evicted >= count) break;
+
+                Slot& slot = slots[index];
+                if (static_cast<int>(slot.priority) != priority || slot.state != state) continue;
+
+                evicted += slot.system.evict(count - evicted);
+            }
+        }
+    }
+
+    evictedParticles += evicted;
+    return evicted;
+}
+
+void ParticlePool::recycleDrained() {
+    std::size_t i = 0;
+    while (i < activeSlots.size()) {
+        const Slot& slot = slots[activeSlots[i]];
+
+        // 已归还且粒子全部消失的系统回到空闲列表
+        if (slot.state == SlotState::Draining && !slot.system.hasActiveParticles()) {
+            recycle(i);
+            continue;
+        }
+
+        ++i;
+    }
+}
+
+void ParticlePool::recycle(std::size_t activeIndex) {
+    std::uint32_t index = activeSlots[activeIndex];
+    activeSlots[activeIndex] = activeSlots.back();
+    activeSlots.pop_back();
+
+    // 代数递增使所有旧句柄失效
+    Slot& slot = slots[index];
+    slot.system.reset();
+    slot.generation++;
+    slot.state = SlotState::Free;
+    freeSlots.push_back(index);
+}
@@ -0,0 +1,156 @@
+#ifndef PARTICLE_POOL_H
+#define PARTICLE_POOL_H
+
+#include <vector>
+#include <cstdint>
+#include "../core/Config.h"
+#include "../entities/ParticleSystem.h"
+#include "../utils/ThreadPool.h"
+#include "ParticleRenderer.h"
+
+// 粒子系统句柄（槽位下标 + 代数，槽位被回收后旧句柄自动失效）
+struct ParticleHandle {
+    static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    std::uint32_t index = INVALID_INDEX;
+    std::uint32_t generation = 0;
+
+    bool isValid() const { return index != INVALID_INDEX; }
+};
+
+// 粒子系统优先级（预算紧张时低优先级先被限流和淘汰）
+enum class ParticlePriority {
+    Aura,      // 光环：纯装饰
+    Trail,     // 拖尾：表现运动轨迹
+    Collision  // 碰撞爆发：玩家操作的反馈，不限流
+};
+
+// 全局粒子池
+// 游戏开始时一次性分配所有粒子系统及其粒子内存，障碍物通过句柄借用。
+// 归还的系统停止发射，剩余粒子播放完毕后回到空闲列表，内存保留复用。
+// 所有系统共享一个粒子预算：接近预算时按优先级降低持续发射速率，
+// 超出预算时从最低优先级（已归还的系统优先）开始淘汰粒子。
+// 包围盒在可见区域之外的系统不绘制、暂停装饰性的持续发射，并降低更新频率。
+class ParticlePool {
+public:
+    ParticlePool(std::size_t systemCount = Config::PARTICLE_POOL_SYSTEMS,
+                 std::size_t particlesPerSystem = Config::PARTICLE_POOL_SYSTEM_CAPACITY);
+
+    // 借用一个粒子系统（池耗尽时返回无效句柄）
+    ParticleHandle acquire(ParticleRenderer::Layer layer, ParticlePriority priority);
+
+    // 归还粒子系统：停止发射，剩余粒子继续播放直到消失
+    void release(ParticleHandle& handle);
+
+    // 通过句柄获取粒子系统（句柄无效或已过期时返回 nullptr）
+    ParticleSystem* get(const ParticleHandle& handle);
+    const ParticleSystem* get(const ParticleHandle& handle) const;
+    
+    // 在预算内一次性发射粒子：预算不足时先淘汰更低优先级的粒子，仍不足则减少数量。
+    // 返回实际发射的数量
+    int burst(const ParticleHandle& handle, int count);
+
+    // 更新所有使用中的粒子系统，回收已播放完毕的系统
+    void update(float deltaTime);
+    
+    // 多线程版本：粒子足够多时把各个系统分给线程池并行更新。
+    // 每个系统使用自己的随机数生成器，结果与线程调度无关。
+    void update(float deltaTime, ThreadPool& threadPool);
+
+    // 设置可见区域（通常每帧取自当前 sf::View）
+    void setViewBounds(const sf::FloatRect& bounds);
+    const sf::FloatRect& getViewBounds() const { return viewBounds; }
+
+    // 把可见的粒子加入顶点批次
+    void collect(ParticleBatch& batch) const;
+
+    // 立即回收所有粒子系统（重新开始游戏时使用）
+    void clear();
+
+    // 粒子预算
+    void setBudget(int newBudget) { budget = newBudget; }
+    int getBudget() const { return budget; }
+    
+    // 画质设置：持续发射速率倍数、新粒子最小尺寸倍数、是否允许借用光环系统。
+    // 关闭光环后已有的光环系统停止发射，剩余粒子自然消失
+    void setEmissionMultiplier(float multiplier) { emissionMultiplier = multiplier; }
+    void setMinSizeScale(float scale) { minSizeScale = scale; }
+    void setAuraEnabled(bool enabled) { auraEnabled = enabled; }
+
+    // 统计信息
+    int getActiveSystemCount() const { return static_cast<int>(activeSlots.size()); }
+    int getActiveParticleCount() const;
+    int getEvictedParticleCount() const { return evictedParticles; }
+
+private:
+    // 槽位状态
+    enum class SlotState {
+        Free,      // 空闲
+        Leased,    // 被障碍物借用
+        Draining   // 已归还，等待剩余粒子消失
+    };
+
+    struct Slot {
+        ParticleSystem system;
+        std::uint32_t generation = 0;
+        SlotState state = SlotState::Free;
+        ParticleRenderer::Layer layer = ParticleRenderer::Layer::Under;
+        ParticlePriority priority = ParticlePriority::Trail;
+        float pendingTime = 0.0f;  // 不可见时跳过更新累积的时间
+    };
+
+    static constexpr int PRIORITY_COUNT = 3;
+
+    std::vector<Slot> slots;
+
+    // 空闲槽位下标
+    std::vector<std::uint32_t> freeSlots;
+
+    // 使用中（借用或回收中）的槽位下标
+    std::vector<std::uint32_t> activeSlots;
+
+    // 同屏粒子总数上限
+    int budget;
+    
+    // 可见区域（已向外扩展剔除边距）
+    sf::FloatRect viewBounds;
+    
+    // 更新计数，用于错开不可见系统的更新
+    std::uint32_t frameIndex;
+    
+    // 累计淘汰的粒子数（调试统计）
+    int evictedParticles;
+    
+    // 画质设置
+    float emissionMultiplier;
+    float minSizeScale;
+    bool auraEnabled;
+
+    // 系统的包围盒是否与可见区域相交
+    // 发射区域实时检查：不可见的系统包围盒更新较慢，发射器移入视野时不必等待下次更新
+    bool isVisible(const ParticleSystem& system) const {
+        return system.getBounds().intersects(viewBounds) ||
+               (system.isEmitterRunning() && system.getEmitterBounds().intersects(viewBounds));
+    }
+    
+    // 更新一个槽位（不可见的系统每隔几帧才更新一次）
+    void updateSlot(std::uint32_t index, float deltaTime);
+
+    // 根据当前粒子数、画质和可见性设置各系统的持续发射缩放
+    void applyEmissionThrottle(int liveParticles);
+    
+    // 粒子总数超出预算时淘汰多余的粒子
+    void enforceBudget();
+    
+    // 从优先级低于 priorityLimit 的系统中淘汰最多 count 个粒子，
+    // 同一优先级中先淘汰已归还的系统。返回实际淘汰数量
+    int evictParticles(int count, int priorityLimit);
+
+    // 回收槽位到空闲列表
+    void recycle(std::size_t activeIndex);
+    
+    // 回收所有已归还且播放完毕的系统
+    void recycleDrained();
+};
+
+#endif
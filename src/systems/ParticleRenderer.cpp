@@ -0,0 +1,94 @@
+#include "ParticleRenderer.h"
+#include <algorithm>
+#include <cmath>
+
+ParticleRenderer::ParticleRenderer() {
+    createCircleTexture();
+}
+
+int ParticleRenderer::draw(sf::RenderTarget& target, const ParticleBatch& batch, Layer layer) const {
+    const sf::VertexArray& quads = batch.getVertices(layer);
+    if (quads.getVertexCount() == 0) return 0;
+
+    sf::RenderStates states;
+    states.texture = &circleTexture;
+    target.draw(quads, states);
+    return 1;
+}
+
+ParticleBatch::ParticleBatch() {
+    for (auto& layer : vertices) {
+        layer.setPrimitiveType(sf::Quads);
+    }
+}
+
+void ParticleBatch::clear() {
+    for (auto& layer : vertices) {
+        layer.clear();
+    }
+}
+
+void ParticleBatch::add(const ParticleSystem& system, ParticleRenderer::Layer layer) {
+    const ParticleStorage& particles = system.getParticles();
+    if (particles.empty()) return;
+
+    sf::VertexArray& quads = vertices[static_cast<int>(layer)];
+    std::size_t base = quads.getVertexCount();
+    quads.resize(base + particles.size() * 4);
+
+    float textureSize = static_cast<float>(ParticleRenderer::TEXTURE_SIZE);
+
+    // 每个粒子写成一个以位置为中心、边长为直径的四边形
+    for (std::size_t i = 0; i < particles.size(); i++) {
+        const sf::Vector2f& position = particles.positions[i];
+        float size = particles.getSize(i);
+        sf::Color color = particles.getDrawColor(i);
+
+        sf::Vertex* quad = &quads[base + i * 4];
+
+        quad[0].position = sf::Vector2f(position.x - size, position.y - size);
+        quad[1].position = sf::Vector2f(position.x + size, position.y - size);
+        quad[2].position = sf::Vector2f(position.x + size, position.y + size);
+        quad[3].position = sf::Vector2f(position.x - size, position.y + size);
+
+        quad[0].texCoords = sf::Vector2f(0, 0);
+        quad[1].texCoords = sf::Vector2f(textureSize, 0);
+        quad[2].texCoords = sf::Vector2f(textureSize, textureSize);
+        quad[3].texCoords = sf::Vector2f(0, textureSize);
+
+        quad[0].color = color;
+        quad[1].color = color;
+        quad[2].color = color;
+        quad[3].color = color;
+    }
+}
+
+std::size_t ParticleBatch::getParticleCount() const {
+    std::size_t count = 0;
+    for (const auto& layer : vertices) {
+        count += layer.getVertexCount() / 4;
+    }
+    return count;
+}
+
+void ParticleRenderer::createCircleTexture() {
+    // 白色圆形，边缘一圈做透明度渐变（抗锯齿），颜色由顶点提供
+    sf::Image image;
+    image.create(TEXTURE_SIZE, TEXTURE_SIZE, sf::Color::Transparent);
+
+    float radius = TEXTURE_SIZE / 2.0f;
+    float feather = radius * 0.15f;
+
+    for (unsigned int y = 0; y < TEXTURE_SIZE; y++) {
+        for (unsigned int x = 0; x < TEXTURE_SIZE; x++) {
+            float dx = x + 0.5f - radius;
+            float dy = y + 0.5f - radius;
+            float distance = std::sqrt(dx * dx + dy * dy);
+            float alpha = std::min(std::max((radius - distance) / feather, 0.0f), 1.0f);
+            image.setPixel(x, y, sf::Color(255, 255, 255, static_cast<sf::Uint8>(alpha * 255.0f)));
+        }
+    }
+
+    circleTexture.loadFromImage(image);
+    circleTexture.setSmooth(true);
+}
@@ -0,0 +1,61 @@
+#ifndef PARTICLE_RENDERER_H
+#define PARTICLE_RENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include "../entities/ParticleSystem.h"
+
+class ParticleBatch;
+
+// 粒子渲染器
+// 持有共享的软边圆形纹理，把 ParticleBatch 中的顶点按图层绘制，每个图层只需一次绘制调用
+class ParticleRenderer {
+public:
+    // 绘制图层
+    enum class Layer {
+        Under,  // 障碍物下方（拖尾、光环）
+        Over    // 障碍物上方（碰撞效果）
+    };
+
+    static constexpr int LAYER_COUNT = 2;
+    static constexpr unsigned int TEXTURE_SIZE = 64;
+
+    ParticleRenderer();
+
+    // 绘制指定图层，返回绘制调用次数（图层为空时为 0）
+    int draw(sf::RenderTarget& target, const ParticleBatch& batch, Layer layer) const;
+
+private:
+    // 共享软边圆形纹理
+    sf::Texture circleTexture;
+
+    // 生成圆形纹理
+    void createCircleTexture();
+};
+
+// 粒子顶点批次
+// 每帧把所有粒子系统的粒子写成四边形放入同一个顶点数组。
+// 只有顶点数据、不涉及纹理，可以在模拟线程填写后交给渲染线程绘制。
+class ParticleBatch {
+public:
+    ParticleBatch();
+
+    // 清空上一帧的顶点（保留容量）
+    void clear();
+
+    // 添加一个粒子系统的所有粒子
+    void add(const ParticleSystem& system, ParticleRenderer::Layer layer);
+
+    // 指定图层的顶点
+    const sf::VertexArray& getVertices(ParticleRenderer::Layer layer) const {
+        return vertices[static_cast<int>(layer)];
+    }
+
+    // 获取本帧已添加的粒子数量
+    std::size_t getParticleCount() const;
+
+private:
+    // 每个图层一个顶点数组
+    sf::VertexArray vertices[ParticleRenderer::LAYER_COUNT];
+};
+
+#endif
@@ -0,0 +1,102 @@
+#include "PerformanceReport.h"
+#include "../utils/Logger.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+    // 报告中的百分位数
+    const double PERCENTILES[] = { 50.0, 90.0, 99.0, 99.9 };
+    const char* const PERCENTILE_NAMES[] = { "p50", "p90", "p99", "p99_9" };
+
+    double toMilliseconds(std::uint64_t microseconds) {
+        return microseconds / 1000.0;
+    }
+}
+
+PerformanceReport::PerformanceReport() : levelCount(0) {
+}
+
+void PerformanceReport::recordFrame(float frameTime) {
+    frameTimes.record(static_cast<std::uint64_t>(std::max(frameTime, 0.0f) * 1000000.0f));
+}
+
+void PerformanceReport::recordLoad(int speedLevel, std::size_t obstacleCount, std::size_t particleCount) {
+    int level = std::min(std::max(speedLevel, 0), MAX_SPEED_LEVELS - 1);
+    LevelStats& stats = levels[level];
+    stats.frames++;
+    stats.peakObstacles = std::max(stats.peakObstacles, obstacleCount);
+    stats.peakParticles = std::max(stats.peakParticles, particleCount);
+    levelCount = std::max(levelCount, level + 1);
+}
+
+bool PerformanceReport::write(const std::string& jsonPath, const std::string& csvPath,
+                              const char* reason, const char* quality) const {
+    bool ok = writeJson(jsonPath, reason, quality) && appendCsv(csvPath, reason, quality);
+    if (ok) {
+        LOG_INFO(LogCategory::Render, "Performance report written to %s (p99 %.2f ms over %llu frames)",
+                 jsonPath.c_str(), toMilliseconds(frameTimes.getPercentile(99.0)),
+                 static_cast<unsigned long long>(frameTimes.getCount()));
+    }
+    return ok;
+}
+
+bool PerformanceReport::writeJson(const std::string& path, const char* reason, const char* quality) const {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        LOG_ERROR(LogCategory::Render, "Failed to write performance report: %s", path.c_str());
+        return false;
+    }
+
+    std::fprintf(file, "{\n  \"reason\": \"%s\",\n  \"quality\": \"%s\",\n", reason, quality);
+    std::fprintf(file, "  \"frames\": %llu,\n", static_cast<unsigned long long>(frameTimes.getCount()));
+
+    std::fprintf(file, "  \"frameTimeMs\": {\n    \"mean\": %.3f,\n", frameTimes.getMean() / 1000.0);
+    for (int i = 0; i < 4; i++) {
+        std::fprintf(file, "    \"%s\": %.3f,\n", PERCENTILE_NAMES[i],
+                     toMilliseconds(frameTimes.getPercentile(PERCENTILES[i])));
+    }
+    std::fprintf(file, "    \"max\": %.3f\n  },\n", toMilliseconds(frameTimes.getMax()));
+
+    std::fprintf(file, "  \"speedLevels\": [");
+    for (int level = 0; level < levelCount; level++) {
+        const LevelStats& stats = levels[level];
+        std::fprintf(file, "%s\n    { \"level\": %d, \"frames\": %llu, \"peakObstacles\": %zu, \"peakParticles\": %zu }",
+                     level == 0 ? "" : ",", level, static_cast<unsigned long long>(stats.frames),
+                     stats.peakObstacles, stats.peakParticles);
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+
+    return std::fclose(file) == 0;
+}
+
+bool PerformanceReport::appendCsv(const std::string& path, const char* reason, const char* quality) const {
+    std::FILE* file = std::fopen(path.c_str(), "a");
+    if (!file) {
+        LOG_ERROR(LogCategory::Render, "Failed to append performance report: %s", path.c_str());
+        return false;
+    }
+
+    // 新文件先写表头
+    std::fseek(file, 0, SEEK_END);
+    if (std::ftell(file) == 0) {
+        std::fprintf(file, "reason,quality,frames,mean_ms,p50_ms,p90_ms,p99_ms,p99_9_ms,max_ms,"
+                           "max_speed_level,peak_obstacles,peak_particles\n");
+    }
+
+    std::size_t peakObstacles = 0;
+    std::size_t peakParticles = 0;
+    for (int level = 0; level < levelCount; level++) {
+        peakObstacles = std::max(peakObstacles, levels[level].peakObstacles);
+        peakParticles = std::max(peakParticles, levels[level].peakParticles);
+    }
+
+    std::fprintf(file, "%s,%s,%llu,%.3f", reason, quality,
+                 static_cast<unsigned long long>(frameTimes.getCount()), frameTimes.getMean() / 1000.0);
+    for (double percentile : PERCENTILES) {
+        std::fprintf(file, ",%.3f", toMilliseconds(frameTimes.getPercentile(percentile)));
+    }
+    std::fprintf(file, ",%.3f,%d,%zu,%zu\n", toMilliseconds(frameTimes.getMax()),
+                 levelCount - 1, peakObstacles, peakParticles);
+
+    return std::fclose(file) == 0;
+}
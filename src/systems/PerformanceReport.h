@@ -0,0 +1,45 @@
+#ifndef PERFORMANCE_REPORT_H
+#define PERFORMANCE_REPORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "../utils/FrameHistogram.h"
+
+// 本次运行的性能报告
+// 记录每一帧的帧时间和每个速度等级下的障碍物、粒子数峰值（全部是定长数组，记录时不分配内存）。
+// 写出时生成完整的 JSON 报告，并在 CSV 文件末尾追加一行摘要，方便对比不同版本和机器。
+class PerformanceReport {
+public:
+    static constexpr int MAX_SPEED_LEVELS = 32;  // 更高的等级计入最后一项
+
+    PerformanceReport();
+
+    // 帧时间（秒）
+    void recordFrame(float frameTime);
+
+    // 游戏进行中的负载
+    void recordLoad(int speedLevel, std::size_t obstacleCount, std::size_t particleCount);
+
+    // reason 说明写出的时机（game_over / exit），quality 为当前画质名称
+    bool write(const std::string& jsonPath, const std::string& csvPath,
+               const char* reason, const char* quality) const;
+
+    const FrameHistogram& getFrameTimes() const { return frameTimes; }
+
+private:
+    struct LevelStats {
+        std::uint64_t frames = 0;
+        std::size_t peakObstacles = 0;
+        std::size_t peakParticles = 0;
+    };
+
+    FrameHistogram frameTimes;
+    LevelStats levels[MAX_SPEED_LEVELS];
+    int levelCount;  // 出现过的最高等级 + 1
+
+    bool writeJson(const std::string& path, const char* reason, const char* quality) const;
+    bool appendCsv(const std::string& path, const char* reason, const char* quality) const;
+};
+
+#endif
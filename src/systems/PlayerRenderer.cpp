@@ -0,0 +1,62 @@
+#include "PlayerRenderer.h"
+
+PlayerRenderer::PlayerRenderer() {
+    // 主体（位置为左上角，眼睛相对于它摆放）
+    body.setSize(sf::Vector2f(Config::PLAYER_WIDTH, Config::PLAYER_HEIGHT));
+    body.setOutlineColor(sf::Color::White);
+    body.setOutlineThickness(2.0f);
+
+    feedback = body;
+
+    // 眼睛
+    leftEye.setRadius(EYE_RADIUS);
+    leftEye.setFillColor(sf::Color::Black);
+    leftEye.setOutlineColor(sf::Color::White);
+    leftEye.setOutlineThickness(1.0f);
+    leftEye.setPosition(Config::PLAYER_WIDTH * 0.25f - EYE_RADIUS,
+                        Config::PLAYER_HEIGHT * 0.3f - EYE_RADIUS);
+
+    rightEye = leftEye;
+    rightEye.setPosition(Config::PLAYER_WIDTH * 0.75f - EYE_RADIUS,
+                         Config::PLAYER_HEIGHT * 0.3f - EYE_RADIUS);
+
+    float eyeY = Config::PLAYER_HEIGHT * 0.3f;
+    closedEyes[0] = sf::Vertex(sf::Vector2f(Config::PLAYER_WIDTH * 0.25f - EYE_RADIUS, eyeY), sf::Color::Black);
+    closedEyes[1] = sf::Vertex(sf::Vector2f(Config::PLAYER_WIDTH * 0.25f + EYE_RADIUS, eyeY), sf::Color::Black);
+    closedEyes[2] = sf::Vertex(sf::Vector2f(Config::PLAYER_WIDTH * 0.75f - EYE_RADIUS, eyeY), sf::Color::Black);
+    closedEyes[3] = sf::Vertex(sf::Vector2f(Config::PLAYER_WIDTH * 0.75f + EYE_RADIUS, eyeY), sf::Color::Black);
+}
+
+int PlayerRenderer::draw(sf::RenderTarget& target, const PlayerSnapshot& snapshot, float interpolation) {
+    // 所有部件以插值后的左上角为原点整体平移
+    sf::Vector2f position = snapshot.previousPosition +
+                            (snapshot.position - snapshot.previousPosition) * interpolation;
+    sf::RenderStates states;
+    states.transform.translate(position);
+
+    // 先绘制玩家主体
+    body.setFillColor(snapshot.fillColor);
+    target.draw(body, states);
+    int drawCalls = 1;
+
+    // 绘制眼睛（闭眼时画成两条线）
+    if (!snapshot.eyesClosed) {
+        target.draw(leftEye, states);
+        target.draw(rightEye, states);
+        drawCalls += 2;
+    } else {
+        target.draw(closedEyes, 4, sf::Lines, states);
+        drawCalls++;
+    }
+
+    // 绘制射击反馈（射击时发光）
+    if (snapshot.shootFeedback > 0.0f) {
+        float intensity = snapshot.shootFeedback;
+        feedback.setFillColor(sf::Color(255, 255, 255, static_cast<sf::Uint8>(100 * intensity)));
+        feedback.setOutlineColor(sf::Color(255, 255, 255, static_cast<sf::Uint8>(200 * intensity)));
+        target.draw(feedback, states);
+        drawCalls++;
+    }
+
+    return drawCalls;
+}
@@ -0,0 +1,31 @@
+#ifndef PLAYER_RENDERER_H
+#define PLAYER_RENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include "../entities/Player.h"
+
+// 玩家渲染器
+// 形状只创建一次，绘制前按快照写入位置和颜色（玩家本身只保存模拟状态）
+class PlayerRenderer {
+public:
+    PlayerRenderer();
+
+    // interpolation 为上一次与本次模拟更新之间的插值比例（0 - 1）
+    // 返回绘制调用次数
+    int draw(sf::RenderTarget& target, const PlayerSnapshot& snapshot, float interpolation);
+
+private:
+    static constexpr float EYE_RADIUS = 6.0f;
+
+    sf::RectangleShape body;
+    sf::RectangleShape feedback;  // 射击时的发光
+
+    // 眼睛形状
+    sf::CircleShape leftEye;
+    sf::CircleShape rightEye;
+
+    // 闭合的眼睛（两条线）
+    sf::Vertex closedEyes[4];
+};
+
+#endif
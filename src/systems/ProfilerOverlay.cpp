@@ -0,0 +1,113 @@
+#include "ProfilerOverlay.h"
+#include "../core/Config.h"
+#include "../utils/AllocationCounter.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+    const float PADDING = 6.0f;
+
+    // 每帧分配次数（平均 / 最大）和最大字节数，未开启分配统计时不显示
+    void appendAllocations(std::ostringstream& stream, float average, std::uint32_t max, std::uint32_t maxBytes) {
+        if (!AllocationCounter::isEnabled()) return;
+        stream << "   alloc " << std::setprecision(1) << average << " / " << max
+               << " (" << maxBytes << " B)" << std::setprecision(2);
+    }
+
+    // 每个代码段一行，嵌套的代码段缩进
+    void appendScopes(std::ostringstream& stream, const Profiler::Summary& summary) {
+        stream << "  frame  " << summary.averageFrame << " / " << summary.maxFrame << " ms";
+        appendAllocations(stream, summary.averageFrameAllocations, summary.maxFrameAllocations,
+                          summary.maxFrameBytes);
+        stream << "\n";
+        for (int id = 0; id < summary.scopeCount; id++) {
+            const Profiler::ScopeStats& scope = summary.scopes[id];
+            stream << std::string(2 * (scope.depth + 2), ' ') << scope.name << "  "
+                   << scope.average << " / " << scope.max << " ms";
+            appendAllocations(stream, scope.averageAllocations, scope.maxAllocations, scope.maxBytes);
+            stream << "\n";
+        }
+    }
+}
+
+ProfilerOverlay::ProfilerOverlay() : graph(sf::Lines, 2 * Profiler::HISTORY) {
+    background.setFillColor(sf::Color(0, 0, 0, 190));
+    background.setOutlineColor(sf::Color(100, 200, 255, 150));
+    background.setOutlineThickness(1.0f);
+
+    targetLine[0].color = sf::Color(255, 255, 255, 120);
+    targetLine[1].color = sf::Color(255, 255, 255, 120);
+
+    text.setCharacterSize(CHARACTER_SIZE);
+    text.setFillColor(sf::Color::White);
+}
+
+void ProfilerOverlay::setFont(const sf::Font& font) {
+    text.setFont(font);
+}
+
+int ProfilerOverlay::draw(sf::RenderTarget& target, const Profiler& renderProfiler,
+                          const Profiler::Summary& simulationProfile, const Counters& counters) {
+    sf::Vector2f origin(Config::WINDOW_WIDTH - WIDTH - MARGIN, MARGIN);
+    updateGraph(renderProfiler, origin + sf::Vector2f(PADDING, PADDING));
+
+    const Profiler::Summary& renderProfile = renderProfiler.getSummary();
+
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(2);
+    stream << "FPS: " << static_cast<int>(counters.fps)
+           << "   Draw calls: " << counters.drawCalls << "\n";
+    stream << "Particles: " << counters.activeParticles << " active, "
+           << counters.drawnParticles << " drawn (budget " << counters.particleBudget << ")\n";
+    stream << "Render (avg / max over " << renderProfile.frameCount << " frames)\n";
+    appendScopes(stream, renderProfile);
+    stream << "Simulation (avg / max over " << simulationProfile.frameCount << " loops)\n";
+    appendScopes(stream, simulationProfile);
+
+    text.setString(stream.str());
+    text.setPosition(origin.x + PADDING, origin.y + 2 * PADDING + Config::PROFILER_GRAPH_HEIGHT);
+
+    sf::FloatRect textBounds = text.getLocalBounds();
+    background.setPosition(origin);
+    background.setSize(sf::Vector2f(WIDTH, 3 * PADDING + Config::PROFILER_GRAPH_HEIGHT +
+                                           textBounds.top + textBounds.height));
+
+    target.draw(background);
+    target.draw(graph);
+    target.draw(targetLine, 2, sf::Lines);
+    target.draw(text);
+    return 4;
+}
+
+void ProfilerOverlay::updateGraph(const Profiler& renderProfiler, const sf::Vector2f& origin) {
+    const float graphWidth = WIDTH - 2 * PADDING;
+    const float maxTime = Config::PROFILER_GRAPH_MAX_TIME * 1000.0f;
+    const float targetTime = Config::QUALITY_TARGET_FRAME_TIME * 1000.0f;
+    const float bottom = origin.y + Config::PROFILER_GRAPH_HEIGHT;
+    const float step = graphWidth / Profiler::HISTORY;
+
+    // 最新的帧在最右侧；还没有记录的位置高度为 0
+    for (int i = 0; i < Profiler::HISTORY; i++) {
+        int framesAgo = Profiler::HISTORY - 1 - i;
+        float frameTime = renderProfiler.getFrameTime(framesAgo);
+        float height = std::min(frameTime / maxTime, 1.0f) * Config::PROFILER_GRAPH_HEIGHT;
+
+        sf::Color color = sf::Color(100, 255, 100);
+        if (frameTime > 2.0f * targetTime) {
+            color = sf::Color(255, 80, 80);
+        } else if (frameTime > targetTime) {
+            color = sf::Color(255, 220, 80);
+        }
+
+        float x = origin.x + (i + 0.5f) * step;
+        graph[2 * i].position = sf::Vector2f(x, bottom);
+        graph[2 * i].color = color;
+        graph[2 * i + 1].position = sf::Vector2f(x, bottom - height);
+        graph[2 * i + 1].color = color;
+    }
+
+    float targetY = bottom - std::min(targetTime / maxTime, 1.0f) * Config::PROFILER_GRAPH_HEIGHT;
+    targetLine[0].position = sf::Vector2f(origin.x, targetY);
+    targetLine[1].position = sf::Vector2f(origin.x + graphWidth, targetY);
+}
@@ -0,0 +1,43 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include "../utils/Profiler.h"
+
+// 性能覆盖层
+// 右上角显示渲染线程最近的帧时间曲线、渲染和模拟线程各代码段的平均/最大耗时，
+// 以及粒子数和绘制调用次数。形状和文字对象只创建一次，每次绘制重写内容。
+class ProfilerOverlay {
+public:
+    // 计时器之外的实时计数
+    struct Counters {
+        std::size_t activeParticles = 0;  // 模拟中存活的粒子
+        std::size_t drawnParticles = 0;   // 可见、实际绘制的粒子
+        std::size_t particleBudget = 0;
+        int drawCalls = 0;                // 上一帧的绘制调用次数（不含覆盖层本身）
+        float fps = 0.0f;
+    };
+
+    ProfilerOverlay();
+
+    void setFont(const sf::Font& font);
+
+    // 返回绘制调用次数
+    int draw(sf::RenderTarget& target, const Profiler& renderProfiler,
+             const Profiler::Summary& simulationProfile, const Counters& counters);
+
+private:
+    static constexpr float WIDTH = 420.0f;
+    static constexpr float MARGIN = 10.0f;
+    static constexpr unsigned int CHARACTER_SIZE = 12;
+
+    sf::RectangleShape background;
+    sf::VertexArray graph;       // 每帧一条竖线
+    sf::Vertex targetLine[2];    // 目标帧时间
+    sf::Text text;
+
+    void updateGraph(const Profiler& renderProfiler, const sf::Vector2f& origin);
+};
+
+#endif
@@ -0,0 +1,100 @@
+#include "QualityController.h"
+#include "../core/Config.h"
+#include <algorithm>
+
+namespace {
+    // 按 QualityLevel 顺序排列
+    const QualitySettings QUALITY_TABLE[] = {
+        // emission budget minSize aura   shadows
+        {  0.4f,    0.5f,  0.5f,   false, false },  // Low
+        {  0.7f,    0.75f, 0.75f,  true,  false },  // Medium
+        {  1.0f,    1.0f,  1.0f,   true,  true  }   // High
+    };
+}
+
+QualityController::QualityController()
+    : level(QualityLevel::High),
+      averageFrameTime(Config::QUALITY_TARGET_FRAME_TIME),
+      averageWorkTime(Config::QUALITY_TARGET_FRAME_TIME),
+      slowTimer(0.0f), fastTimer(0.0f), timeSinceChange(0.0f),
+      upgradeHold(Config::QUALITY_UPGRADE_HOLD),
+      lastChangeWasUpgrade(false) {
+}
+
+bool QualityController::update(float frameTime, float workTime) {
+    // 异常长的帧不代表渲染负载
+    if (frameTime > Config::QUALITY_MAX_SAMPLE) return false;
+
+    averageFrameTime += (frameTime - averageFrameTime) * Config::QUALITY_SMOOTHING;
+    averageWorkTime += (workTime - averageWorkTime) * Config::QUALITY_SMOOTHING;
+    timeSinceChange += frameTime;
+
+    const float target = Config::QUALITY_TARGET_FRAME_TIME;
+
+    if (averageFrameTime > target * Config::QUALITY_DOWNGRADE_RATIO) {
+        slowTimer += frameTime;
+        fastTimer = 0.0f;
+    } else if (averageWorkTime < target * Config::QUALITY_UPGRADE_RATIO) {
+        fastTimer += frameTime;
+        slowTimer = 0.0f;
+    } else {
+        // 处于两个阈值之间：保持当前等级
+        slowTimer = 0.0f;
+        fastTimer = 0.0f;
+    }
+
+    if (timeSinceChange < Config::QUALITY_CHANGE_COOLDOWN) return false;
+
+    if (slowTimer >= Config::QUALITY_DOWNGRADE_HOLD && level != QualityLevel::Low) {
+        // 刚升级就撑不住，说明空闲的工作时间不可信，推迟下次升级
+        if (lastChangeWasUpgrade && timeSinceChange < Config::QUALITY_UPGRADE_PROBATION) {
+            upgradeHold = std::min(upgradeHold * 2.0f, Config::QUALITY_MAX_UPGRADE_HOLD);
+        }
+
+        changeLevel(static_cast<QualityLevel>(static_cast<int>(level) - 1));
+        lastChangeWasUpgrade = false;
+        return true;
+    }
+
+    if (fastTimer >= upgradeHold && level != QualityLevel::High) {
+        changeLevel(static_cast<QualityLevel>(static_cast<int>(level) + 1));
+        lastChangeWasUpgrade = true;
+        return true;
+    }
+
+    return false;
+}
+
+const QualitySettings& QualityController::getSettings() const {
+    return getSettings(level);
+}
+
+const QualitySettings& QualityController::getSettings(QualityLevel level) {
+    return QUALITY_TABLE[static_cast<int>(level)];
+}
+
+const char* QualityController::getLevelName(QualityLevel level) {
+    switch (level) {
+        case QualityLevel::Low:    return "Low";
+        case QualityLevel::Medium: return "Medium";
+        case QualityLevel::High:   return "High";
+    }
+    return "Unknown";
+}
+
+void QualityController::setLevel(QualityLevel newLevel) {
+    changeLevel(newLevel);
+    upgradeHold = Config::QUALITY_UPGRADE_HOLD;
+    lastChangeWasUpgrade = false;
+}
+
+void QualityController::changeLevel(QualityLevel newLevel) {
+    level = newLevel;
+    slowTimer = 0.0f;
+    fastTimer = 0.0f;
+    timeSinceChange = 0.0f;
+
+    // 新等级的帧时间需要重新统计
+    averageFrameTime = Config::QUALITY_TARGET_FRAME_TIME;
+    averageWorkTime = Config::QUALITY_TARGET_FRAME_TIME;
+}
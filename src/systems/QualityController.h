@@ -0,0 +1,69 @@
+#ifndef QUALITY_CONTROLLER_H
+#define QUALITY_CONTROLLER_H
+
+// 画质等级
+enum class QualityLevel {
+    Low,
+    Medium,
+    High
+};
+
+// 每个画质等级对应的装饰效果参数
+struct QualitySettings {
+    float emissionScale;   // 持续发射速率倍数
+    float budgetScale;     // 粒子预算倍数
+    float minSizeScale;    // 粒子最小尺寸倍数（越小填充的像素越少）
+    bool auraEnabled;      // 是否启用光环粒子
+    bool textShadows;      // 开始界面文字是否绘制阴影
+};
+
+// 自适应画质控制器
+// 根据实测帧时间升降画质等级：
+//   平均帧间隔持续超过目标时降级；
+//   平均工作时间（不含垂直同步/限帧等待）持续低于目标较多时升级。
+// 两个阈值之间留有空档，每次切换后有冷却时间；
+// 升级后很快又降级说明瓶颈不在CPU，下次升级需要等待更久。
+class QualityController {
+public:
+    QualityController();
+
+    // 每帧调用一次
+    // frameTime: 两帧之间的实际间隔
+    // workTime:  本帧CPU工作时间（不含等待）
+    // 返回画质等级是否改变
+    bool update(float frameTime, float workTime);
+
+    QualityLevel getLevel() const { return level; }
+    const QualitySettings& getSettings() const;
+
+    // 指定画质等级的参数
+    static const QualitySettings& getSettings(QualityLevel level);
+
+    // 画质等级名称
+    static const char* getLevelName(QualityLevel level);
+
+    // 强制设置画质等级（重置统计）
+    void setLevel(QualityLevel newLevel);
+
+private:
+    QualityLevel level;
+
+    // 平滑后的帧时间和工作时间
+    float averageFrameTime;
+    float averageWorkTime;
+
+    // 持续超过降级阈值 / 低于升级阈值的时间
+    float slowTimer;
+    float fastTimer;
+
+    // 距离上次切换的时间
+    float timeSinceChange;
+
+    // 当前升级所需的持续时间（升级后迅速降级时加倍）
+    float upgradeHold;
+    bool lastChangeWasUpgrade;
+
+    void changeLevel(QualityLevel newLevel);
+};
+
+#endif
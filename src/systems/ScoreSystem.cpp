@@ -1,7 +1,7 @@
 #include "ScoreSystem.h"
 #include <sstream>
 
-ScoreSystem::ScoreSystem() : score(0), timeAlive(0.0f) {
+ScoreSystem::ScoreSystem() : score(0), timeAlive(0.0f), textDirty(true) {
     scoreText.setCharacterSize(24);
     scoreText.setFillColor(sf::Color::White);
     scoreText.setStyle(sf::Text::Bold);
@@ -10,10 +10,14 @@ ScoreSystem::ScoreSystem() : score(0), timeAlive(0.0f) {
 void ScoreSystem::update(float deltaTime) {
     timeAlive += deltaTime;
     score = static_cast<int>(timeAlive * 10); // 每0.1秒得1分
-    updateText();
+    textDirty = true;
 }
 
 void ScoreSystem::draw(sf::RenderWindow& window) {
+    // 文字只在绘制前重建，模拟更新中不做字符串格式化（避免堆分配）
+    if (textDirty) {
+        updateText();
+    }
     window.draw(scoreText);
 }
 
@@ -26,12 +30,20 @@ void ScoreSystem::setFont(const sf::Font& font) {
 void ScoreSystem::reset() {
     score = 0;
     timeAlive = 0.0f;
-    updateText();
+    textDirty = true;
 }
 
 void ScoreSystem::addScore(int points) {
     score += points;
-    updateText();
+    textDirty = true;
+}
+
+void ScoreSystem::setState(int newScore, float newTimeAlive) {
+    if (newScore != score || static_cast<int>(newTimeAlive) != static_cast<int>(timeAlive)) {
+        textDirty = true;
+    }
+    score = newScore;
+    timeAlive = newTimeAlive;
 }
 
 void ScoreSystem::updateText() {
@@ -39,4 +51,5 @@ void ScoreSystem::updateText() {
     ss << "Score: " << score << "\nTime: " << static_cast<int>(timeAlive) << "s";
     scoreText.setString(ss.str());
     scoreText.setPosition(10, 10);
+    textDirty = false;
 }
\ No newline at end of file
@@ -22,13 +22,18 @@ public:
     // 新增：增加分数
     void addScore(int points);
     
+    // 只用于显示时：直接设置分数和存活时间（显示的数值不变时不重建文字）
+    void setState(int newScore, float newTimeAlive);
+    
+    // 按当前分数和时间重建文字（通常由 draw 在数值变化后调用）
+    void updateText();
+    
 private:
     int score;
     float timeAlive;
     sf::Font font;
     sf::Text scoreText;
-    
-    void updateText();
+    bool textDirty;  // 分数或时间变化后需要重建文字
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "ScriptedInput.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+ScriptedInput::ScriptedInput() : cursor(0), sorted(true) {
+}
+
+bool ScriptedInput::loadFromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Failed to open input script: " << path << std::endl;
+        return false;
+    }
+
+    events.clear();
+    cursor = 0;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+
+        std::size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+
+        std::istringstream fields(line);
+        int tick;
+        std::string action;
+        std::string keyName;
+        if (!(fields >> tick)) continue;  // 空行
+
+        if (!(fields >> action >> keyName) || tick < 0 ||
+            (action != "press" && action != "release")) {
+            std::cerr << path << ":" << lineNumber << ": expected '<tick> press|release <key>'" << std::endl;
+            return false;
+        }
+
+        sf::Keyboard::Key key = parseKey(keyName);
+        if (key == sf::Keyboard::Unknown) {
+            std::cerr << path << ":" << lineNumber << ": unknown key '" << keyName << "'" << std::endl;
+            return false;
+        }
+
+        addKey(tick, key, action == "press");
+    }
+
+    return true;
+}
+
+void ScriptedInput::createAutoplay(int ticks) {
+    events.clear();
+    cursor = 0;
+
+    const int MOVE_PERIOD = 90;     // 每 0.75 秒换一次方向
+    const int SHOOT_PERIOD = 420;   // 每 3.5 秒射击一次
+    const int RESTART_PERIOD = 60;  // 每 0.5 秒按一次 R（只在游戏结束时生效）
+
+    // 任意键开始游戏
+    addKey(0, sf::Keyboard::Enter, true);
+    addKey(1, sf::Keyboard::Enter, false);
+
+    bool movingLeft = true;
+    for (int tick = MOVE_PERIOD; tick < ticks; tick += MOVE_PERIOD) {
+        addKey(tick, movingLeft ? sf::Keyboard::Left : sf::Keyboard::Right, true);
+        addKey(tick + MOVE_PERIOD - 1, movingLeft ? sf::Keyboard::Left : sf::Keyboard::Right, false);
+        movingLeft = !movingLeft;
+    }
+
+    for (int tick = SHOOT_PERIOD; tick < ticks; tick += SHOOT_PERIOD) {
+        addKey(tick, sf::Keyboard::Space, true);
+        addKey(tick + 1, sf::Keyboard::Space, false);
+    }
+
+    for (int tick = RESTART_PERIOD; tick < ticks; tick += RESTART_PERIOD) {
+        addKey(tick, sf::Keyboard::R, true);
+        addKey(tick + 1, sf::Keyboard::R, false);
+    }
+}
+
+void ScriptedInput::addKey(int tick, sf::Keyboard::Key key, bool pressed) {
+    events.push_back({ tick, key, pressed });
+    sorted = false;
+}
+
+bool ScriptedInput::pollEvent(int tick, sf::Event& event) {
+    if (!sorted) {
+        // 同一步内保持添加顺序
+        std::stable_sort(events.begin(), events.end(),
+            [](const ScriptedEvent& a, const ScriptedEvent& b) { return a.tick < b.tick; });
+        sorted = true;
+    }
+
+    if (cursor >= events.size() || events[cursor].tick > tick) {
+        return false;
+    }
+
+    const ScriptedEvent& scripted = events[cursor++];
+    event = sf::Event();
+    event.type = scripted.pressed ? sf::Event::KeyPressed : sf::Event::KeyReleased;
+    event.key.code = scripted.key;
+    return true;
+}
+
+sf::Keyboard::Key ScriptedInput::parseKey(const std::string& name) {
+    static const struct {
+        const char* name;
+        sf::Keyboard::Key key;
+    } KEYS[] = {
+        { "Left", sf::Keyboard::Left },   { "Right", sf::Keyboard::Right },
+        { "Up", sf::Keyboard::Up },       { "Down", sf::Keyboard::Down },
+        { "A", sf::Keyboard::A },         { "D", sf::Keyboard::D },
+        { "W", sf::Keyboard::W },         { "S", sf::Keyboard::S },
+        { "Space", sf::Keyboard::Space }, { "Enter", sf::Keyboard::Enter },
+        { "R", sf::Keyboard::R },         { "M", sf::Keyboard::M },
+        { "H", sf::Keyboard::H },         { "Escape", sf::Keyboard::Escape }
+    };
+
+    for (const auto& entry : KEYS) {
+        if (name == entry.name) return entry.key;
+    }
+    return sf::Keyboard::Unknown;
+}
@@ -0,0 +1,52 @@
+#ifndef SCRIPTED_INPUT_H
+#define SCRIPTED_INPUT_H
+
+#include <SFML/Window.hpp>
+#include <string>
+#include <vector>
+
+// 脚本输入源
+// 按模拟步数给出预先安排好的按键事件，代替窗口事件驱动模拟（无窗口运行、自动测试）。
+// 脚本文件每行一条：<步数> <press|release> <按键>，# 开头为注释，例如
+//   0   press   Space
+//   120 press   Left
+//   240 release Left
+// 按键名称：Left Right Up Down A D W S Space Enter R M H Escape
+class ScriptedInput {
+public:
+    ScriptedInput();
+
+    // 从文件加载脚本（替换已有事件），失败时返回 false 并输出原因
+    bool loadFromFile(const std::string& path);
+
+    // 内置的自动操作：开始游戏，左右来回移动并间隔射击，游戏结束后按 R 重新开始。
+    // 覆盖 [0, ticks) 步
+    void createAutoplay(int ticks);
+
+    // 添加一个按键事件（可以乱序添加，取事件前会按步数排序）
+    void addKey(int tick, sf::Keyboard::Key key, bool pressed);
+
+    // 取出第 tick 步及之前尚未取出的下一个事件，没有时返回 false（与 Window::pollEvent 用法相同）
+    bool pollEvent(int tick, sf::Event& event);
+
+    // 回到脚本开头
+    void rewind() { cursor = 0; }
+
+    std::size_t getEventCount() const { return events.size(); }
+
+    // 按键名称与按键的转换，未知名称返回 Unknown
+    static sf::Keyboard::Key parseKey(const std::string& name);
+
+private:
+    struct ScriptedEvent {
+        int tick;
+        sf::Keyboard::Key key;
+        bool pressed;
+    };
+
+    std::vector<ScriptedEvent> events;
+    std::size_t cursor;
+    bool sorted;
+};
+
+#endif
@@ -0,0 +1,93 @@
+#include "SpatialHash.h"
+#include <cmath>
+
+namespace {
+    // 格子坐标范围（远超可见区域，只为避免浮点转整数溢出）
+    const float MAX_CELL_COORDINATE = 1 << 20;
+
+    // 至少 2 倍元素数量的桶，保持哈希冲突较少
+    std::uint32_t chooseBucketCount(std::size_t elementCount) {
+        std::uint32_t count = 64;
+        while (count < elementCount * 2) {
+            count <<= 1;
+        }
+        return count;
+    }
+}
+
+SpatialHash::SpatialHash(float cellSize)
+    : cellSize(cellSize), inverseCellSize(1.0f / cellSize) {
+}
+
+void SpatialHash::reserve(std::size_t count) {
+    std::uint32_t bucketCount = chooseBucketCount(count);
+    elementBounds.reserve(count);
+    bucketStart.reserve(bucketCount + 1);
+    bucketCursor.reserve(bucketCount);
+    entries.reserve(count * 4);  // 包围盒不大于格子时最多跨 4 个格子
+    visitStamps.reserve(count);
+}
+
+int SpatialHash::toCell(float coordinate) const {
+    float cell = std::floor(coordinate * inverseCellSize);
+    cell = std::min(std::max(cell, -MAX_CELL_COORDINATE), MAX_CELL_COORDINATE);
+    return static_cast<int>(cell);
+}
+
+std::uint32_t SpatialHash::hashCell(int x, int y) const {
+    std::uint32_t hash = static_cast<std::uint32_t>(x) * 73856093u ^ static_cast<std::uint32_t>(y) * 19349663u;
+    return hash & bucketMask;
+}
+
+std::uint32_t SpatialHash::nextQueryStamp() {
+    queryStamp++;
+    if (queryStamp == 0) {
+        // 编号回绕：清空记录，避免与很久以前的查询混淆
+        std::fill(visitStamps.begin(), visitStamps.end(), 0);
+        queryStamp = 1;
+    }
+    return queryStamp;
+}
+
+void SpatialHash::build(const std::vector<sf::FloatRect>& bounds) {
+    elementBounds.assign(bounds.begin(), bounds.end());
+    visitStamps.assign(bounds.size(), 0);
+    queryStamp = 0;
+
+    std::uint32_t bucketCount = chooseBucketCount(bounds.size());
+    bucketMask = bucketCount - 1;
+    bucketStart.assign(bucketCount + 1, 0);
+
+    // 第一遍：统计每个桶的元素数量（存放在下一个桶的起始位置，便于求前缀和）
+    for (const sf::FloatRect& rect : elementBounds) {
+        const int minX = toCell(rect.left);
+        const int maxX = toCell(rect.left + rect.width);
+        const int minY = toCell(rect.top);
+        const int maxY = toCell(rect.top + rect.height);
+        for (int y = minY; y <= maxY; y++) {
+            for (int x = minX; x <= maxX; x++) {
+                bucketStart[hashCell(x, y) + 1]++;
+            }
+        }
+    }
+
+    for (std::uint32_t b = 0; b < bucketCount; b++) {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+
+    // 第二遍：写入元素编号
+    entries.resize(bucketStart[bucketCount]);
+    bucketCursor.assign(bucketStart.begin(), bucketStart.end() - 1);
+    for (std::uint32_t id = 0; id < elementBounds.size(); id++) {
+        const sf::FloatRect& rect = elementBounds[id];
+        const int minX = toCell(rect.left);
+        const int maxX = toCell(rect.left + rect.width);
+        const int minY = toCell(rect.top);
+        const int maxY = toCell(rect.top + rect.height);
+        for (int y = minY; y <= maxY; y++) {
+            for (int x = minX; x <= maxX; x++) {
+                entries[bucketCursor[hashCell(x, y)]++] = id;
+            }
+        }
+    }
+}
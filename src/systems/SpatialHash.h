@@ -0,0 +1,105 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "../core/Config.h"
+
+// 均匀网格空间哈希（碰撞检测的粗筛阶段）
+// 世界按固定边长切成格子，格子坐标哈希到桶中，没有世界边界限制。
+// 每帧用计数排序整体重建：所有桶的内容连续存放在一个数组里，
+// 查询只访问与查询区域重叠的格子，再用包围盒精确过滤。
+// 包围盒跨越多个格子时会出现在多个桶中，查询时按编号去重。
+class SpatialHash {
+public:
+    explicit SpatialHash(float cellSize = Config::SPATIAL_HASH_CELL_SIZE);
+
+    // 预留容量（元素数量不超过该值时重建不分配内存）
+    void reserve(std::size_t count);
+
+    // 用一组包围盒重建网格，元素编号即数组下标
+    void build(const std::vector<sf::FloatRect>& bounds);
+
+    // 对与 area 相交的每个元素调用 visit(编号)，每个元素最多一次，顺序不固定
+    template <typename Visitor>
+    void query(const sf::FloatRect& area, Visitor&& visit);
+
+    // 对包围盒与圆相交的每个元素调用 visit(编号)
+    template <typename Visitor>
+    void queryRadius(const sf::Vector2f& center, float radius, Visitor&& visit);
+
+    float getCellSize() const { return cellSize; }
+    std::size_t size() const { return elementBounds.size(); }
+
+private:
+    float cellSize;
+    float inverseCellSize;
+
+    std::vector<sf::FloatRect> elementBounds;
+    std::vector<std::uint32_t> bucketStart;   // 桶 b 的内容为 entries[bucketStart[b], bucketStart[b + 1])
+    std::vector<std::uint32_t> bucketCursor;  // 重建时的写入位置
+    std::vector<std::uint32_t> entries;       // 元素编号
+    std::vector<std::uint32_t> visitStamps;   // 元素最近一次被访问的查询编号（去重）
+    std::uint32_t queryStamp = 0;
+    std::uint32_t bucketMask = 0;
+
+    int toCell(float coordinate) const;
+    std::uint32_t hashCell(int x, int y) const;
+
+    // 开始一次新查询，返回查询编号
+    std::uint32_t nextQueryStamp();
+};
+
+template <typename Visitor>
+void SpatialHash::query(const sf::FloatRect& area, Visitor&& visit) {
+    if (elementBounds.empty()) return;
+
+    const std::uint32_t stamp = nextQueryStamp();
+    const int minX = toCell(area.left);
+    const int maxX = toCell(area.left + area.width);
+    const int minY = toCell(area.top);
+    const int maxY = toCell(area.top + area.height);
+
+    // 查询区域覆盖的格子比桶还多时，直接遍历所有元素更快
+    const std::uint64_t cellCount = static_cast<std::uint64_t>(maxX - minX + 1) * (maxY - minY + 1);
+    if (cellCount > bucketMask + 1u) {
+        for (std::uint32_t id = 0; id < elementBounds.size(); id++) {
+            if (elementBounds[id].intersects(area)) visit(id);
+        }
+        return;
+    }
+
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            const std::uint32_t bucket = hashCell(x, y);
+            for (std::uint32_t i = bucketStart[bucket]; i < bucketStart[bucket + 1]; i++) {
+                const std::uint32_t id = entries[i];
+                if (visitStamps[id] == stamp) continue;
+                visitStamps[id] = stamp;
+
+                if (elementBounds[id].intersects(area)) visit(id);
+            }
+        }
+    }
+}
+
+template <typename Visitor>
+void SpatialHash::queryRadius(const sf::Vector2f& center, float radius, Visitor&& visit) {
+    const sf::FloatRect area(center.x - radius, center.y - radius, radius * 2, radius * 2);
+    const float radiusSquared = radius * radius;
+
+    query(area, [&](std::uint32_t id) {
+        // 圆心到包围盒的最近点
+        const sf::FloatRect& bounds = elementBounds[id];
+        float nearestX = std::min(std::max(center.x, bounds.left), bounds.left + bounds.width);
+        float nearestY = std::min(std::max(center.y, bounds.top), bounds.top + bounds.height);
+        float dx = center.x - nearestX;
+        float dy = center.y - nearestY;
+        if (dx * dx + dy * dy <= radiusSquared) visit(id);
+    });
+}
+
+#endif
@@ -0,0 +1,120 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+    std::atomic<std::uint64_t> allocationCount(0);
+    thread_local std::uint64_t threadAllocationCount = 0;
+    thread_local std::uint64_t threadAllocatedBytes = 0;
+    thread_local int threadExcludeDepth = 0;
+}
+
+bool AllocationCounter::isEnabled() {
+#ifdef SIMPLERUNNER_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::uint64_t AllocationCounter::getAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+std::uint64_t AllocationCounter::getThreadAllocationCount() {
+    return threadAllocationCount;
+}
+
+std::uint64_t AllocationCounter::getThreadAllocatedBytes() {
+    return threadAllocatedBytes;
+}
+
+AllocationCounter::Exclude::Exclude() {
+    threadExcludeDepth++;
+}
+
+AllocationCounter::Exclude::~Exclude() {
+    threadExcludeDepth--;
+}
+
+#ifdef SIMPLERUNNER_TRACK_ALLOCATIONS
+
+namespace {
+    void countAllocation(std::size_t size) {
+        if (threadExcludeDepth > 0) return;
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        threadAllocationCount++;
+        threadAllocatedBytes += size;
+    }
+
+    void* allocate(std::size_t size) {
+        countAllocation(size);
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+        countAllocation(size);
+
+        std::size_t align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+        return _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+        // aligned_alloc 要求大小是对齐值的整数倍
+        std::size_t rounded = (size + align - 1) / align * align;
+        return std::aligned_alloc(align, rounded == 0 ? align : rounded);
+#endif
+    }
+
+    void freeAligned(void* ptr) {
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (void* ptr = allocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* ptr = allocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = allocateAligned(size, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = allocateAligned(size, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { freeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { freeAligned(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { freeAligned(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { freeAligned(ptr); }
+
+#endif
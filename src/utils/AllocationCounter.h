@@ -0,0 +1,33 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstdint>
+
+// 堆分配计数
+// 替换全局 operator new，统计程序启动以来的分配次数和字节数。
+// 在一段代码前后各取一次，差值就是这段代码的分配量（Profiler 以此按代码段统计每帧的分配）。
+// 编译时不定义 SIMPLERUNNER_TRACK_ALLOCATIONS 则不替换 operator new，所有计数始终为 0。
+class AllocationCounter {
+public:
+    // 是否编译了分配钩子
+    static bool isEnabled();
+
+    // 所有线程的分配次数
+    static std::uint64_t getAllocationCount();
+
+    // 当前线程的分配次数和字节数（不受其他线程同时分配的影响）
+    static std::uint64_t getThreadAllocationCount();
+    static std::uint64_t getThreadAllocatedBytes();
+
+    // 作用域内当前线程的分配不计数（工具自身的分配，例如时间线缓冲区）
+    class Exclude {
+    public:
+        Exclude();
+        ~Exclude();
+
+        Exclude(const Exclude&) = delete;
+        Exclude& operator=(const Exclude&) = delete;
+    };
+};
+
+#endif
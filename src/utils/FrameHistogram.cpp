@@ -0,0 +1,68 @@
+#include "FrameHistogram.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+FrameHistogram::FrameHistogram() {
+    reset();
+}
+
+void FrameHistogram::record(std::uint64_t microseconds) {
+    counts[getBucketIndex(microseconds)]++;
+    count++;
+    sum += microseconds;
+    min = std::min(min, microseconds);
+    max = std::max(max, microseconds);
+}
+
+void FrameHistogram::reset() {
+    std::fill(std::begin(counts), std::end(counts), 0);
+    count = 0;
+    sum = 0;
+    min = UINT64_MAX;
+    max = 0;
+}
+
+std::uint64_t FrameHistogram::getPercentile(double percentile) const {
+    if (count == 0) return 0;
+
+    // 排名向上取整（最近秩法）：只有 1 个样本时任何百分位数都是它本身
+    double clamped = std::min(std::max(percentile, 0.0), 100.0);
+    std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * count));
+    rank = std::max<std::uint64_t>(rank, 1);
+
+    std::uint64_t seen = 0;
+    for (int index = 0; index < BUCKET_COUNT; index++) {
+        seen += counts[index];
+        if (seen >= rank) {
+            return std::min(getBucketUpperBound(index), max);
+        }
+    }
+    return max;
+}
+
+int FrameHistogram::getBucketIndex(std::uint64_t value) {
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<int>(value);
+    }
+
+    // 最高位以下保留 SUB_BUCKET_BITS 位：index = 指数 * 128 + [128, 256)
+    int exponent = 0;
+    while ((value >> exponent) >= 2 * SUB_BUCKET_COUNT) {
+        exponent++;
+    }
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    return static_cast<int>(exponent * SUB_BUCKET_COUNT + (value >> exponent));
+}
+
+std::uint64_t FrameHistogram::getBucketUpperBound(int index) {
+    if (index < static_cast<int>(SUB_BUCKET_COUNT)) {
+        return static_cast<std::uint64_t>(index);
+    }
+
+    int exponent = index / SUB_BUCKET_COUNT - 1;
+    std::uint64_t subBucket = index - exponent * SUB_BUCKET_COUNT;
+    return ((subBucket + 1) << exponent) - 1;
+}
@@ -0,0 +1,40 @@
+#ifndef FRAME_HISTOGRAM_H
+#define FRAME_HISTOGRAM_H
+
+#include <cstdint>
+
+// 帧时间直方图（HDR 风格，固定内存）
+// 以微秒记录。小于 128 的值每个值一个桶；更大的值按 2 的幂分段，每段再均分成 128 个桶，
+// 相对误差不超过 1/128（约 0.8%）。记录和查询都不分配内存，适合每帧调用。
+class FrameHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 7;
+    static constexpr std::uint32_t SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+    static constexpr int MAX_EXPONENT = 20;  // 最大约 2^28 微秒（268 秒），超出的值计入最后一个桶
+    static constexpr int BUCKET_COUNT = SUB_BUCKET_COUNT * (MAX_EXPONENT + 2);
+
+    FrameHistogram();
+
+    void record(std::uint64_t microseconds);
+    void reset();
+
+    std::uint64_t getCount() const { return count; }
+    std::uint64_t getMax() const { return max; }
+    std::uint64_t getMin() const { return count > 0 ? min : 0; }
+    double getMean() const { return count > 0 ? static_cast<double>(sum) / count : 0.0; }
+
+    // 百分位数（0 - 100），返回该桶能表示的最大值（不超过实际记录到的最大值）
+    std::uint64_t getPercentile(double percentile) const;
+
+private:
+    std::uint64_t counts[BUCKET_COUNT];
+    std::uint64_t count;
+    std::uint64_t sum;
+    std::uint64_t min;
+    std::uint64_t max;
+
+    static int getBucketIndex(std::uint64_t value);
+    static std::uint64_t getBucketUpperBound(int index);
+};
+
+#endif
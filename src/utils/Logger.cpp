@@ -0,0 +1,168 @@
+#include "Logger.h"
+#include "AllocationCounter.h"
+#include "../core/Config.h"
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    const Clock::time_point startTime = Clock::now();
+
+    const std::uint64_t CAPACITY = static_cast<std::uint64_t>(Config::LOG_QUEUE_CAPACITY);
+    const std::uint64_t MASK = CAPACITY - 1;
+
+    static_assert((Config::LOG_QUEUE_CAPACITY & (Config::LOG_QUEUE_CAPACITY - 1)) == 0,
+                  "LOG_QUEUE_CAPACITY must be a power of two");
+}
+
+// 队列槽位：sequence 等于位置时可以写入，等于位置 + 1 时可以读出（有界多生产者队列）
+struct Logger::Slot {
+    std::atomic<std::uint64_t> sequence;
+    LogLevel level;
+    LogCategory category;
+    float time;
+    char text[Config::LOG_MESSAGE_SIZE];
+};
+
+Logger& Logger::getInstance() {
+    static Logger instance;
+    return instance;
+}
+
+Logger::Logger()
+    : slots(nullptr),
+      enqueuePosition(0),
+      dequeuePosition(0),
+      writtenPosition(0),
+      dropped(0),
+      categoryMask((1u << static_cast<int>(LogCategory::Count)) - 1),
+      running(true) {
+
+    // 日志自身的缓冲区和线程不计入调用者的分配（第一次写日志可能发生在模拟更新中）
+    AllocationCounter::Exclude exclude;
+    slots = new Slot[CAPACITY];
+    for (std::uint64_t i = 0; i < CAPACITY; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    writerThread = std::thread(&Logger::writerLoop, this);
+}
+
+Logger::~Logger() {
+    running.store(false);
+    writerThread.join();
+
+    std::uint64_t lost = dropped.load();
+    if (lost > 0) {
+        std::fprintf(stderr, "Logger dropped %llu message(s)\n", static_cast<unsigned long long>(lost));
+    }
+    delete[] slots;
+}
+
+void Logger::write(LogLevel level, LogCategory category, const char* format, ...) {
+    // 占用一个槽位；队列满（最早的槽位还没写出）时放弃
+    std::uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+        slot = &slots[position & MASK];
+        std::uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        std::int64_t difference = static_cast<std::int64_t>(sequence - position);
+
+        if (difference == 0) {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->level = level;
+    slot->category = category;
+    slot->time = std::chrono::duration<float>(Clock::now() - startTime).count();
+
+    va_list arguments;
+    va_start(arguments, format);
+    std::vsnprintf(slot->text, sizeof(slot->text), format, arguments);
+    va_end(arguments);
+
+    slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+void Logger::setCategoryEnabled(LogCategory category, bool enabled) {
+    std::uint32_t bit = 1u << static_cast<int>(category);
+    if (enabled) {
+        categoryMask.fetch_or(bit, std::memory_order_relaxed);
+    } else {
+        categoryMask.fetch_and(~bit, std::memory_order_relaxed);
+    }
+}
+
+void Logger::flush() {
+    std::uint64_t target = enqueuePosition.load(std::memory_order_acquire);
+    while (writtenPosition.load(std::memory_order_acquire) < target) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void Logger::writerLoop() {
+    while (running.load(std::memory_order_relaxed)) {
+        if (!writePending()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(Config::LOG_FLUSH_INTERVAL_MS));
+        }
+    }
+
+    // 退出前写出剩余的消息
+    while (writePending()) {
+    }
+}
+
+bool Logger::writePending() {
+    bool wrote = false;
+    while (true) {
+        Slot& slot = slots[dequeuePosition & MASK];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) break;
+
+        std::fprintf(stdout, "%9.3f %-7s [%s] %s\n", slot.time, getLevelName(slot.level),
+                     getCategoryName(slot.category), slot.text);
+
+        // 槽位交还给下一轮的生产者
+        slot.sequence.store(dequeuePosition + CAPACITY, std::memory_order_release);
+        dequeuePosition++;
+        wrote = true;
+    }
+
+    if (wrote) {
+        std::fflush(stdout);
+        writtenPosition.store(dequeuePosition, std::memory_order_release);
+    }
+    return wrote;
+}
+
+const char* Logger::getLevelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info: return "INFO";
+        case LogLevel::Warning: return "WARNING";
+        case LogLevel::Error: return "ERROR";
+    }
+    return "";
+}
+
+const char* Logger::getCategoryName(LogCategory category) {
+    switch (category) {
+        case LogCategory::Game: return "game";
+        case LogCategory::Player: return "player";
+        case LogCategory::Collision: return "collision";
+        case LogCategory::Spawn: return "spawn";
+        case LogCategory::Difficulty: return "difficulty";
+        case LogCategory::Render: return "render";
+        case LogCategory::Count: break;
+    }
+    return "";
+}
@@ -0,0 +1,113 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+// 编译时的最低日志级别（0 调试，1 信息，2 警告，3 错误，4 关闭），低于该级别的 LOG_* 展开为空语句
+#ifndef SIMPLERUNNER_LOG_LEVEL
+#define SIMPLERUNNER_LOG_LEVEL 1
+#endif
+
+enum class LogLevel {
+    Debug,
+    Info,
+    Warning,
+    Error
+};
+
+enum class LogCategory {
+    Game,        // 游戏流程（开始、结束、菜单）
+    Player,      // 玩家操作（射击）
+    Collision,
+    Spawn,       // 障碍物生成
+    Difficulty,
+    Render,      // 画质、时间线记录
+    Count
+};
+
+// 异步日志
+// 调用线程在无锁环形队列中占一个槽位并直接格式化进去（不分配内存、不加锁），
+// 后台线程定期取出写到标准输出。队列满时丢弃消息并计数，不会阻塞调用线程。
+// 可以同时从多个线程写入。
+class Logger {
+public:
+    static Logger& getInstance();
+
+    // printf 风格格式化，超出单条长度的部分截断
+    void write(LogLevel level, LogCategory category, const char* format, ...)
+#if defined(__GNUC__)
+        __attribute__((format(printf, 4, 5)))
+#endif
+        ;
+
+    // 运行时开关某个类别（默认全部开启）
+    void setCategoryEnabled(LogCategory category, bool enabled);
+    bool isCategoryEnabled(LogCategory category) const {
+        return (categoryMask.load(std::memory_order_relaxed) >> static_cast<int>(category)) & 1u;
+    }
+
+    // 等待已提交的消息全部写出（与直接写标准输出的代码交替输出时保持顺序）
+    void flush();
+
+    // 因队列满而丢弃的消息数
+    std::uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+    static const char* getLevelName(LogLevel level);
+    static const char* getCategoryName(LogCategory category);
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+private:
+    Logger();
+    ~Logger();
+
+    struct Slot;
+
+    Slot* slots;
+    alignas(64) std::atomic<std::uint64_t> enqueuePosition;
+    alignas(64) std::uint64_t dequeuePosition;   // 只由后台线程访问
+    std::atomic<std::uint64_t> writtenPosition;  // 已写出的位置（flush 等待用）
+    std::atomic<std::uint64_t> dropped;
+    std::atomic<std::uint32_t> categoryMask;
+
+    std::thread writerThread;
+    std::atomic<bool> running;
+
+    void writerLoop();
+    bool writePending();  // 写出队列中的全部消息，没有消息时返回 false
+};
+
+#define SIMPLERUNNER_LOG(level, category, ...) \
+    do { \
+        Logger& logger_ = Logger::getInstance(); \
+        if (logger_.isCategoryEnabled(category)) logger_.write(level, category, __VA_ARGS__); \
+    } while (0)
+
+#if SIMPLERUNNER_LOG_LEVEL <= 0
+#define LOG_DEBUG(category, ...) SIMPLERUNNER_LOG(LogLevel::Debug, category, __VA_ARGS__)
+#else
+#define LOG_DEBUG(category, ...) ((void)0)
+#endif
+
+#if SIMPLERUNNER_LOG_LEVEL <= 1
+#define LOG_INFO(category, ...) SIMPLERUNNER_LOG(LogLevel::Info, category, __VA_ARGS__)
+#else
+#define LOG_INFO(category, ...) ((void)0)
+#endif
+
+#if SIMPLERUNNER_LOG_LEVEL <= 2
+#define LOG_WARNING(category, ...) SIMPLERUNNER_LOG(LogLevel::Warning, category, __VA_ARGS__)
+#else
+#define LOG_WARNING(category, ...) ((void)0)
+#endif
+
+#if SIMPLERUNNER_LOG_LEVEL <= 3
+#define LOG_ERROR(category, ...) SIMPLERUNNER_LOG(LogLevel::Error, category, __VA_ARGS__)
+#else
+#define LOG_ERROR(category, ...) ((void)0)
+#endif
+
+#endif
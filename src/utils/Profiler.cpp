@@ -0,0 +1,179 @@
+#include "Profiler.h"
+#include "AllocationCounter.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace {
+    std::uint32_t toCount(std::uint64_t value) {
+        return static_cast<std::uint32_t>(std::min<std::uint64_t>(value, UINT32_MAX));
+    }
+
+    void clearFrameScopes(float* scopes, std::uint32_t* allocations, std::uint32_t* bytes, int count) {
+        std::fill(scopes, scopes + count, 0.0f);
+        std::fill(allocations, allocations + count, 0u);
+        std::fill(bytes, bytes + count, 0u);
+    }
+}
+
+Profiler::Profiler()
+    : scopeCount(0), depth(0), frameStartAllocations(0), frameStartBytes(0),
+      current(0), recorded(0), framesSinceSummary(0) {
+    std::fill(std::begin(names), std::end(names), nullptr);
+    std::fill(std::begin(depths), std::end(depths), 0);
+    for (Frame& frame : frames) {
+        frame.total = 0.0f;
+        frame.allocations = 0;
+        frame.bytes = 0;
+        clearFrameScopes(frame.scopes, frame.scopeAllocations, frame.scopeBytes, MAX_SCOPES);
+    }
+}
+
+void Profiler::beginFrame() {
+    Frame& frame = frames[current];
+    frame.total = 0.0f;
+    frame.allocations = 0;
+    frame.bytes = 0;
+    clearFrameScopes(frame.scopes, frame.scopeAllocations, frame.scopeBytes, scopeCount);
+
+    depth = 0;
+    frameStartAllocations = AllocationCounter::getThreadAllocationCount();
+    frameStartBytes = AllocationCounter::getThreadAllocatedBytes();
+    frameStart = Clock::now();
+}
+
+void Profiler::endFrame() {
+    Frame& frame = frames[current];
+    frame.total = toMilliseconds(Clock::now() - frameStart);
+    frame.allocations = toCount(AllocationCounter::getThreadAllocationCount() - frameStartAllocations);
+    frame.bytes = toCount(AllocationCounter::getThreadAllocatedBytes() - frameStartBytes);
+
+    current = (current + 1) % HISTORY;
+    recorded = std::min(recorded + 1, HISTORY);
+
+    if (++framesSinceSummary >= SUMMARY_INTERVAL) {
+        summarize(summary);
+        framesSinceSummary = 0;
+    }
+}
+
+int Profiler::beginScope(const char* name) {
+    // 同一个字符串常量通常地址相同，地址不同时再比较内容
+    int id = 0;
+    while (id < scopeCount && names[id] != name && std::strcmp(names[id], name) != 0) {
+        id++;
+    }
+
+    if (id == scopeCount) {
+        if (scopeCount == MAX_SCOPES) return -1;
+
+        // 新代码段：之前记录的帧中没有它，耗时和分配为 0
+        names[id] = name;
+        depths[id] = depth;
+        for (Frame& frame : frames) {
+            frame.scopes[id] = 0.0f;
+            frame.scopeAllocations[id] = 0;
+            frame.scopeBytes[id] = 0;
+        }
+        scopeCount++;
+    }
+
+    depth++;
+    scopeStartAllocations[id] = AllocationCounter::getThreadAllocationCount();
+    scopeStartBytes[id] = AllocationCounter::getThreadAllocatedBytes();
+    scopeStarts[id] = Clock::now();
+    return id;
+}
+
+void Profiler::endScope(int id) {
+    if (id < 0) return;
+
+    // 同一帧中多次进入的代码段累计耗时和分配
+    Frame& frame = frames[current];
+    frame.scopes[id] += toMilliseconds(Clock::now() - scopeStarts[id]);
+    frame.scopeAllocations[id] += toCount(AllocationCounter::getThreadAllocationCount() - scopeStartAllocations[id]);
+    frame.scopeBytes[id] += toCount(AllocationCounter::getThreadAllocatedBytes() - scopeStartBytes[id]);
+    depth--;
+}
+
+void Profiler::summarize(Summary& summary) const {
+    summary.scopeCount = scopeCount;
+    summary.frameCount = recorded;
+    summary.averageFrame = 0.0f;
+    summary.maxFrame = 0.0f;
+    summary.lastFrame = recorded > 0 ? getFrameTime(0) : 0.0f;
+    summary.averageFrameAllocations = 0.0f;
+    summary.maxFrameAllocations = 0;
+    summary.maxFrameBytes = 0;
+
+    for (int id = 0; id < scopeCount; id++) {
+        ScopeStats& scope = summary.scopes[id];
+        scope.name = names[id];
+        scope.depth = depths[id];
+        scope.average = 0.0f;
+        scope.max = 0.0f;
+        scope.averageAllocations = 0.0f;
+        scope.maxAllocations = 0;
+        scope.maxBytes = 0;
+    }
+
+    if (recorded == 0) return;
+
+    // 只统计已完成的帧（跳过正在记录的帧）
+    for (int age = 0; age < recorded; age++) {
+        const Frame& frame = frames[(current - 1 - age + HISTORY) % HISTORY];
+
+        summary.averageFrame += frame.total;
+        summary.maxFrame = std::max(summary.maxFrame, frame.total);
+        summary.averageFrameAllocations += frame.allocations;
+        summary.maxFrameAllocations = std::max(summary.maxFrameAllocations, frame.allocations);
+        summary.maxFrameBytes = std::max(summary.maxFrameBytes, frame.bytes);
+
+        for (int id = 0; id < scopeCount; id++) {
+            ScopeStats& scope = summary.scopes[id];
+            scope.average += frame.scopes[id];
+            scope.max = std::max(scope.max, frame.scopes[id]);
+            scope.averageAllocations += frame.scopeAllocations[id];
+            scope.maxAllocations = std::max(scope.maxAllocations, frame.scopeAllocations[id]);
+            scope.maxBytes = std::max(scope.maxBytes, frame.scopeBytes[id]);
+        }
+    }
+
+    summary.averageFrame /= recorded;
+    summary.averageFrameAllocations /= recorded;
+    for (int id = 0; id < scopeCount; id++) {
+        summary.scopes[id].average /= recorded;
+        summary.scopes[id].averageAllocations /= recorded;
+    }
+}
+
+float Profiler::getFrameTime(int framesAgo) const {
+    if (framesAgo < 0 || framesAgo >= recorded) return 0.0f;
+    return frames[(current - 1 - framesAgo + HISTORY) % HISTORY].total;
+}
+
+void Profiler::markAllocations(AllocationMark& mark) const {
+    const Frame& frame = frames[current];
+    mark.scopeCount = scopeCount;
+    std::copy(frame.scopeAllocations, frame.scopeAllocations + scopeCount, mark.scopeAllocations);
+}
+
+const char* Profiler::getTopAllocatingScope(const AllocationMark& since) const {
+    const Frame& frame = frames[current];
+    int top = -1;
+    std::uint32_t topAllocations = 0;
+    for (int id = 0; id < scopeCount; id++) {
+        // mark 之后才出现的代码段从 0 开始计数
+        std::uint32_t allocations = frame.scopeAllocations[id];
+        if (id < since.scopeCount) {
+            allocations -= since.scopeAllocations[id];
+        }
+        if (allocations == 0) continue;
+        if (top < 0 || allocations > topAllocations ||
+            (allocations == topAllocations && depths[id] > depths[top])) {
+            top = id;
+            topAllocations = allocations;
+        }
+    }
+    return top >= 0 ? names[top] : nullptr;
+}
@@ -0,0 +1,135 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include "Tracer.h"
+
+// 分层计时器
+// 每个线程一个实例：beginFrame/endFrame 之间用 PROFILE_SCOPE 标记的代码段按名称累计耗时，
+// 嵌套的代码段记录深度，显示时按首次出现的顺序缩进排列。
+// 最近 HISTORY 帧保存在环形缓冲区中（固定内存），可以统计平均值、最大值和绘制帧时间曲线。
+// 同时记录每个代码段中当前线程的堆分配次数和字节数（包含嵌套的代码段，需要开启分配统计）。
+class Profiler {
+public:
+    static constexpr int MAX_SCOPES = 32;
+    static constexpr int HISTORY = 240;
+    static constexpr int SUMMARY_INTERVAL = 30;  // 每隔多少帧重新统计一次
+
+    // 一个代码段的统计（耗时为毫秒，分配为每帧的次数）
+    struct ScopeStats {
+        const char* name = "";
+        int depth = 0;
+        float average = 0.0f;
+        float max = 0.0f;
+        float averageAllocations = 0.0f;
+        std::uint32_t maxAllocations = 0;
+        std::uint32_t maxBytes = 0;
+    };
+
+    // 所有代码段的统计（定长数组，可以直接复制到渲染快照中）
+    struct Summary {
+        int scopeCount = 0;
+        ScopeStats scopes[MAX_SCOPES];
+        int frameCount = 0;          // 参与统计的帧数
+        float averageFrame = 0.0f;   // 帧耗时（毫秒）
+        float maxFrame = 0.0f;
+        float lastFrame = 0.0f;
+        float averageFrameAllocations = 0.0f;
+        std::uint32_t maxFrameAllocations = 0;
+        std::uint32_t maxFrameBytes = 0;
+    };
+
+    // 某一时刻正在记录的帧中各代码段的累计分配次数
+    // 一帧中可能执行多次同一代码段（例如多次模拟更新），与之后的计数相减得到这段时间内的分配
+    struct AllocationMark {
+        int scopeCount = 0;
+        std::uint32_t scopeAllocations[MAX_SCOPES];
+    };
+
+    Profiler();
+
+    void beginFrame();
+    void endFrame();
+
+    // 开始/结束一个代码段（名称必须是静态字符串）；代码段数量超过上限时返回 -1 并忽略
+    int beginScope(const char* name);
+    void endScope(int id);
+
+    // 统计最近 HISTORY 帧
+    void summarize(Summary& summary) const;
+
+    // 最近一次定期统计的结果（每 SUMMARY_INTERVAL 帧在 endFrame 中更新，读取不需要遍历历史）
+    const Summary& getSummary() const { return summary; }
+
+    // 已记录的帧数（不超过 HISTORY）和 framesAgo 帧之前的帧耗时（毫秒，0 为最近一帧）
+    int getRecordedFrames() const { return recorded; }
+    float getFrameTime(int framesAgo) const;
+
+    // 记录当前的分配计数
+    void markAllocations(AllocationMark& mark) const;
+
+    // 从 mark 到现在已结束的代码段里分配次数最多的一个（次数相同时取嵌套更深的），没有分配时返回 nullptr
+    const char* getTopAllocatingScope(const AllocationMark& since) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Frame {
+        float total;
+        float scopes[MAX_SCOPES];
+        std::uint32_t allocations;
+        std::uint32_t bytes;
+        std::uint32_t scopeAllocations[MAX_SCOPES];
+        std::uint32_t scopeBytes[MAX_SCOPES];
+    };
+
+    // 代码段名称和深度（按首次出现的顺序）
+    const char* names[MAX_SCOPES];
+    int depths[MAX_SCOPES];
+    int scopeCount;
+
+    Clock::time_point frameStart;
+    Clock::time_point scopeStarts[MAX_SCOPES];
+    int depth;
+
+    // 帧和代码段开始时当前线程的分配计数
+    std::uint64_t frameStartAllocations;
+    std::uint64_t frameStartBytes;
+    std::uint64_t scopeStartAllocations[MAX_SCOPES];
+    std::uint64_t scopeStartBytes[MAX_SCOPES];
+
+    Frame frames[HISTORY];
+    int current;   // 正在记录的帧
+    int recorded;
+
+    Summary summary;
+    int framesSinceSummary;
+
+    static float toMilliseconds(Clock::duration duration) {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+};
+
+// 作用域计时：构造时开始，析构时结束
+class ProfileScope {
+public:
+    ProfileScope(Profiler& profiler, const char* name) : profiler(profiler), id(profiler.beginScope(name)) {}
+    ~ProfileScope() { profiler.endScope(id); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler& profiler;
+    int id;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+// 同时写入时间线（开启记录时）
+#define PROFILE_SCOPE(profiler, name) \
+    ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(profiler, name); \
+    TRACE_SCOPE(name)
+
+#endif
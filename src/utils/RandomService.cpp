@@ -0,0 +1,82 @@
+#include "RandomService.h"
+#include <random>
+
+namespace {
+    std::uint64_t splitMix64(std::uint64_t& x) {
+        std::uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+}
+
+RandomStream::RandomStream(std::uint64_t seed) {
+    this->seed(seed);
+}
+
+void RandomStream::seed(std::uint64_t seed) {
+    std::uint64_t x = seed;
+    std::uint64_t a = splitMix64(x);
+    std::uint64_t b = splitMix64(x);
+    state[0] = static_cast<std::uint32_t>(a);
+    state[1] = static_cast<std::uint32_t>(a >> 32);
+    state[2] = static_cast<std::uint32_t>(b);
+    state[3] = static_cast<std::uint32_t>(b >> 32);
+
+    // 全零状态无法产生输出（splitmix64 实际上不会出现，保险起见）
+    if ((state[0] | state[1] | state[2] | state[3]) == 0) {
+        state[0] = 1;
+    }
+}
+
+void RandomStream::fill(float* out, std::size_t count, float min, float max) {
+    // 状态放在局部变量中，循环内不经过内存
+    RandomStream local = *this;
+    const float span = max - min;
+    for (std::size_t i = 0; i < count; i++) {
+        out[i] = min + span * local.nextFloat();
+    }
+    *this = local;
+}
+
+void RandomStream::jump() {
+    static const std::uint32_t JUMP[] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+
+    std::uint32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (std::uint32_t word : JUMP) {
+        for (int b = 0; b < 32; b++) {
+            if (word & (1u << b)) {
+                s0 ^= state[0];
+                s1 ^= state[1];
+                s2 ^= state[2];
+                s3 ^= state[3];
+            }
+            nextU32();
+        }
+    }
+
+    state[0] = s0;
+    state[1] = s1;
+    state[2] = s2;
+    state[3] = s3;
+}
+
+RandomService& RandomService::getInstance() {
+    static RandomService instance;
+    return instance;
+}
+
+RandomService::RandomService() {
+    std::random_device rd;
+    seed((static_cast<std::uint64_t>(rd()) << 32) | rd());
+}
+
+void RandomService::seed(std::uint64_t newSeed) {
+    currentSeed = newSeed;
+
+    RandomStream base(newSeed);
+    for (RandomStream& channel : streams) {
+        channel = base;
+        base.jump();
+    }
+}
@@ -0,0 +1,103 @@
+#ifndef RANDOM_SERVICE_H
+#define RANDOM_SERVICE_H
+
+#include <cstdint>
+#include <cstddef>
+
+// 随机数流（xoshiro128+，状态只有16字节）
+// 浮点数取输出的高24位，整数区间使用乘法映射，都不依赖较弱的低位。
+class RandomStream {
+public:
+    // 由64位种子展开状态（splitmix64）
+    explicit RandomStream(std::uint64_t seed = 0);
+
+    void seed(std::uint64_t seed);
+
+    std::uint32_t nextU32() {
+        const std::uint32_t result = state[0] + state[3];
+        const std::uint32_t t = state[1] << 9;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 11);
+
+        return result;
+    }
+
+    std::uint64_t nextU64() {
+        std::uint64_t high = nextU32();
+        return (high << 32) | nextU32();
+    }
+
+    // [0, 1)
+    float nextFloat() {
+        return (nextU32() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // [min, max)，min > max 时结果在 (max, min] 之间
+    float range(float min, float max) {
+        return min + (max - min) * nextFloat();
+    }
+
+    // [min, max] 闭区间
+    int rangeInt(int min, int max) {
+        std::uint64_t span = static_cast<std::uint32_t>(max - min) + 1ull;
+        return min + static_cast<int>((nextU32() * span) >> 32);
+    }
+
+    // 批量生成 [min, max) 区间的浮点数
+    void fill(float* out, std::size_t count, float min, float max);
+
+    // 跳过 2^64 个输出，用于划分互不重叠的子流
+    void jump();
+
+private:
+    std::uint32_t state[4];
+
+    static std::uint32_t rotl(std::uint32_t x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+};
+
+// 随机数子流（每个子系统一个，互不影响）
+enum class RandomChannel {
+    Spawn,      // 障碍物生成
+    Obstacles,  // 障碍物外观参数
+    Particles,  // 粒子系统种子
+    Player,     // 玩家动画
+    Count
+};
+
+// 全局随机数服务
+// 所有随机数都来自同一个种子：设置相同的种子即可重现整局游戏。
+// 各子流由基础流依次跳跃 2^64 得到，互不重叠。
+// 只能在模拟线程使用；需要在工作线程中使用随机数的对象（粒子系统）
+// 应在模拟线程从对应子流取得种子，然后持有自己的 RandomStream。
+class RandomService {
+public:
+    static RandomService& getInstance();
+
+    // 禁止复制
+    RandomService(const RandomService&) = delete;
+    void operator=(const RandomService&) = delete;
+
+    // 重新设置种子，重置所有子流
+    void seed(std::uint64_t newSeed);
+    std::uint64_t getSeed() const { return currentSeed; }
+
+    RandomStream& stream(RandomChannel channel) {
+        return streams[static_cast<int>(channel)];
+    }
+
+private:
+    // 默认使用 random_device 生成种子
+    RandomService();
+
+    std::uint64_t currentSeed;
+    RandomStream streams[static_cast<int>(RandomChannel::Count)];
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// 无锁单生产者单消费者环形队列（固定容量，不分配内存）
+// 生产者只写 tail，消费者只写 head；队列满时 push 返回 false，由调用者决定丢弃还是重试。
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscQueue capacity must be a power of two");
+
+public:
+    SpscQueue() : head(0), tail(0) {}
+
+    // 禁止复制
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // 生产者线程：加入一个元素，队列满时返回 false
+    bool push(const T& value) {
+        std::size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail - head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+
+        items[currentTail & MASK] = value;
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 消费者线程：取出一个元素，队列空时返回 false
+    bool pop(T& value) {
+        std::size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        value = items[currentHead & MASK];
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    static constexpr std::size_t getCapacity() { return Capacity; }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+
+    std::array<T, Capacity> items;
+
+    // 单调递增的读写位置（取模后才是下标），分开放在不同缓存行避免两个线程互相干扰
+    alignas(64) std::atomic<std::size_t> head;
+    alignas(64) std::atomic<std::size_t> tail;
+};
+
+#endif
@@ -0,0 +1,140 @@
+#include "ThreadPool.h"
+#include "Tracer.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned int workerCount, std::size_t maxRanges)
+    : currentTask(nullptr), pendingRanges(0), jobGeneration(0), stopping(false) {
+
+    if (workerCount == 0) {
+        unsigned int cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 0;
+    }
+
+    // 工作线程的队列 + 调用线程的队列，都按最大块数预留，parallelFor 中不再分配内存
+    for (unsigned int i = 0; i <= workerCount; i++) {
+        queues.push_back(std::make_unique<WorkQueue>());
+        queues.back()->ranges.reserve(maxRanges);
+    }
+
+    workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, static_cast<std::size_t>(i));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t count, std::size_t grainSize, const RangeTask& task) {
+    if (count == 0) return;
+    grainSize = std::max<std::size_t>(grainSize, 1);
+
+    // 没有工作线程或只有一块时直接在当前线程执行
+    if (workers.empty() || count <= grainSize) {
+        task(0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> jobLock(jobMutex);
+
+    // 切块并轮流放入各个队列
+    std::size_t rangeCount = (count + grainSize - 1) / grainSize;
+    currentTask = &task;
+    pendingRanges.store(rangeCount);
+
+    for (std::size_t i = 0; i < rangeCount; i++) {
+        Range range = { i * grainSize, std::min(count, (i + 1) * grainSize) };
+        WorkQueue& queue = *queues[i % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.ranges.push_back(range);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        jobGeneration++;
+    }
+    wakeCondition.notify_all();
+
+    // 调用线程也参与执行
+    std::size_t ownQueue = queues.size() - 1;
+    while (runOne(ownQueue)) {
+    }
+
+    // 等待其他线程完成剩余任务
+    std::unique_lock<std::mutex> lock(doneMutex);
+    doneCondition.wait(lock, [this]() { return pendingRanges.load() == 0; });
+    currentTask = nullptr;
+}
+
+void ThreadPool::workerLoop(std::size_t queueIndex) {
+    Tracer::setThreadName("worker");
+    unsigned int seenGeneration = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCondition.wait(lock, [&]() { return stopping || jobGeneration != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = jobGeneration;
+        }
+
+        while (runOne(queueIndex)) {
+        }
+    }
+}
+
+bool ThreadPool::runOne(std::size_t queueIndex) {
+    Range range;
+    if (!popOwn(queueIndex, range) && !steal(queueIndex, range)) {
+        return false;
+    }
+
+    (*currentTask)(range.begin, range.end);
+
+    // 最后一块完成时通知调用线程
+    if (pendingRanges.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(doneMutex);
+        doneCondition.notify_all();
+    }
+    return true;
+}
+
+bool ThreadPool::popOwn(std::size_t queueIndex, Range& range) {
+    WorkQueue& queue = *queues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.head == queue.ranges.size()) return false;
+
+    range = queue.ranges.back();
+    queue.ranges.pop_back();
+    if (queue.head == queue.ranges.size()) {
+        queue.ranges.clear();
+        queue.head = 0;
+    }
+    return true;
+}
+
+bool ThreadPool::steal(std::size_t queueIndex, Range& range) {
+    // 从下一个队列开始依次尝试，避免所有线程都去抢同一个队列
+    for (std::size_t offset = 1; offset < queues.size(); offset++) {
+        WorkQueue& queue = *queues[(queueIndex + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.head == queue.ranges.size()) continue;
+
+        range = queue.ranges[queue.head++];
+        if (queue.head == queue.ranges.size()) {
+            queue.ranges.clear();
+            queue.head = 0;
+        }
+        return true;
+    }
+    return false;
+}
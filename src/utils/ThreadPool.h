@@ -0,0 +1,81 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 工作窃取线程池
+// parallelFor 把区间切成小块，轮流分配到每个线程自己的队列；
+// 线程先从自己队列尾部取任务，空了再从其他队列头部窃取。
+// 调用线程也参与执行，函数返回时所有任务都已完成。
+class ThreadPool {
+public:
+    // 任务函数：处理 [begin, end) 区间
+    using RangeTask = std::function<void(std::size_t begin, std::size_t end)>;
+
+    // workerCount 为 0 时使用 CPU 核心数 - 1（调用线程算一个）
+    // maxRanges 为一次 parallelFor 最多切出的块数，任务队列按它预先分配
+    explicit ThreadPool(unsigned int workerCount = 0, std::size_t maxRanges = 0);
+    ~ThreadPool();
+
+    // 禁止复制
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // 并行执行 [0, count)，每块最多 grainSize 个元素
+    void parallelFor(std::size_t count, std::size_t grainSize, const RangeTask& task);
+
+    // 后台工作线程数量（不含调用线程）
+    unsigned int getWorkerCount() const { return static_cast<unsigned int>(workers.size()); }
+
+private:
+    struct Range {
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    // 每个线程一个任务队列（最后一个属于调用线程）
+    // 自己从尾部取，窃取者从 head 处取；容量在构造时按 maxRanges 预先分配，
+    // 块数不超过 maxRanges 时 parallelFor 不分配内存
+    struct WorkQueue {
+        std::mutex mutex;
+        std::vector<Range> ranges;
+        std::size_t head = 0;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+
+    // 当前任务
+    const RangeTask* currentTask;
+    std::atomic<std::size_t> pendingRanges;
+
+    // 唤醒工作线程
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    unsigned int jobGeneration;
+    bool stopping;
+
+    // 等待任务完成
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+
+    // 同一时间只允许一个 parallelFor
+    std::mutex jobMutex;
+
+    void workerLoop(std::size_t queueIndex);
+
+    // 从自己的队列或其他队列取一个任务并执行，没有任务时返回 false
+    bool runOne(std::size_t queueIndex);
+
+    bool popOwn(std::size_t queueIndex, Range& range);
+    bool steal(std::size_t queueIndex, Range& range);
+};
+
+#endif
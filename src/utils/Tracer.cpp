@@ -0,0 +1,138 @@
+#include "Tracer.h"
+#include "AllocationCounter.h"
+#include "Logger.h"
+#include "../core/Config.h"
+#include <cstdio>
+#include <memory>
+
+namespace {
+    struct TraceEvent {
+        const char* name;
+        std::int64_t begin;
+        std::int64_t duration;
+    };
+
+    // 一个线程的事件缓冲区
+    // 所属线程写入事件后再发布 count，写出 JSON 的线程只读取 [0, count) 范围内的事件；
+    // 同一次记录中已发布的事件不会被改写。
+    struct ThreadBuffer {
+        std::unique_ptr<TraceEvent[]> events;
+        std::atomic<std::size_t> count{0};
+        std::atomic<std::size_t> dropped{0};
+        std::atomic<unsigned int> session{0};  // 事件属于哪一次记录
+        const char* threadName = nullptr;
+        int threadId = 0;
+        ThreadBuffer* next = nullptr;
+    };
+
+    // 所有线程的缓冲区（只增加不删除，线程结束后事件仍然可以写出）
+    std::atomic<ThreadBuffer*> buffers{nullptr};
+    std::atomic<int> nextThreadId{1};
+    std::atomic<unsigned int> currentSession{0};
+    std::int64_t sessionStart = 0;
+
+    thread_local ThreadBuffer* threadBuffer = nullptr;
+    thread_local const char* threadName = nullptr;
+
+    ThreadBuffer& getThreadBuffer() {
+        if (!threadBuffer) {
+            // 记录工具自身的分配不计入被记录的代码
+            AllocationCounter::Exclude exclude;
+            ThreadBuffer* buffer = new ThreadBuffer();
+            buffer->events.reset(new TraceEvent[Config::TRACE_MAX_EVENTS_PER_THREAD]);
+            buffer->threadName = threadName;
+            buffer->threadId = nextThreadId.fetch_add(1);
+
+            // 无锁链表头部插入
+            buffer->next = buffers.load(std::memory_order_relaxed);
+            while (!buffers.compare_exchange_weak(buffer->next, buffer,
+                                                  std::memory_order_release, std::memory_order_relaxed)) {
+            }
+            threadBuffer = buffer;
+        }
+        return *threadBuffer;
+    }
+
+    void writeEvent(std::FILE* file, bool& first, const TraceEvent& event, int threadId) {
+        // 时间单位为微秒，保留纳秒精度
+        std::fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                     first ? "" : ",", event.name, threadId,
+                     (event.begin - sessionStart) / 1000.0, event.duration / 1000.0);
+        first = false;
+    }
+}
+
+std::atomic<bool> Tracer::enabled{false};
+
+void Tracer::start() {
+    // 缓冲区在所属线程下一次记录时清空
+    currentSession.fetch_add(1, std::memory_order_release);
+    sessionStart = now();
+    enabled.store(true, std::memory_order_release);
+}
+
+bool Tracer::stop(const std::string& path) {
+    enabled.store(false, std::memory_order_release);
+    unsigned int session = currentSession.load(std::memory_order_acquire);
+
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        LOG_ERROR(LogCategory::Render, "Failed to write trace: %s", path.c_str());
+        return false;
+    }
+
+    std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+    std::size_t eventCount = 0;
+    std::size_t droppedCount = 0;
+
+    for (ThreadBuffer* buffer = buffers.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+        if (buffer->session.load(std::memory_order_acquire) != session) continue;
+
+        if (buffer->threadName) {
+            std::fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                               "\"args\":{\"name\":\"%s\"}}",
+                         first ? "" : ",", buffer->threadId, buffer->threadName);
+            first = false;
+        }
+
+        std::size_t count = buffer->count.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < count; i++) {
+            writeEvent(file, first, buffer->events[i], buffer->threadId);
+        }
+        eventCount += count;
+        droppedCount += buffer->dropped.load(std::memory_order_relaxed);
+    }
+
+    std::fprintf(file, "\n]}\n");
+    bool ok = std::fclose(file) == 0;
+
+    LOG_INFO(LogCategory::Render, "Trace written to %s (%zu events, %zu dropped)",
+             path.c_str(), eventCount, droppedCount);
+    return ok;
+}
+
+void Tracer::setThreadName(const char* name) {
+    threadName = name;
+}
+
+void Tracer::record(const char* name, std::int64_t begin, std::int64_t end) {
+    ThreadBuffer& buffer = getThreadBuffer();
+
+    // 新的一次记录：丢弃上一次的事件
+    unsigned int session = currentSession.load(std::memory_order_acquire);
+    if (buffer.session.load(std::memory_order_relaxed) != session) {
+        buffer.count.store(0, std::memory_order_relaxed);
+        buffer.dropped.store(0, std::memory_order_relaxed);
+        buffer.session.store(session, std::memory_order_release);
+    }
+
+    std::size_t index = buffer.count.load(std::memory_order_relaxed);
+    if (index >= static_cast<std::size_t>(Config::TRACE_MAX_EVENTS_PER_THREAD)) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.events[index] = TraceEvent{ name, begin, end - begin };
+    buffer.count.store(index + 1, std::memory_order_release);
+}
@@ -0,0 +1,59 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// 时间线记录（Chrome trace_event 格式，可以用 Perfetto 或 chrome://tracing 打开）
+// 每个线程第一次记录时创建自己的事件缓冲区，只有该线程写入，写入不加锁也不等待；
+// 缓冲区写满后丢弃后续事件并计数。未开启记录时每个代码段只多一次原子读取。
+class Tracer {
+public:
+    // 开始新的记录（之前记录的事件作废）
+    static void start();
+
+    // 停止记录并写出 JSON，返回是否写出成功
+    static bool stop(const std::string& path);
+
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    // 当前线程在时间线中显示的名称（名称必须是静态字符串，在该线程第一次记录之前设置）
+    static void setThreadName(const char* name);
+
+    // 记录一个完整的代码段（纳秒时间戳，来自 now()）
+    static void record(const char* name, std::int64_t begin, std::int64_t end);
+
+    static std::int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+// 作用域记录：构造时记录中才会在析构时写入事件
+class TraceScope {
+public:
+    explicit TraceScope(const char* name)
+        : name(Tracer::isEnabled() ? name : nullptr), begin(this->name ? Tracer::now() : 0) {}
+
+    ~TraceScope() {
+        if (name) Tracer::record(name, begin, Tracer::now());
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    std::int64_t begin;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+
+#endif
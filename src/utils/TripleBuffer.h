@@ -0,0 +1,67 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+
+// 无锁三缓冲（一个写线程，一个读线程）
+// 写线程独占后缓冲区，写完后与中间缓冲区交换并标记为新数据；
+// 读线程只在有新数据时把前缓冲区与中间缓冲区交换。
+// 双方都不会等待对方：写线程可以比读线程快（中间的旧数据被覆盖），
+// 读线程在没有新数据时继续使用上一次取得的缓冲区。
+// 缓冲区在两个线程之间循环使用，其中的容器保留容量，不会反复分配内存。
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : middle(2), back(0), front(1) {}
+
+    // 禁止复制
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // 写线程：当前可写的缓冲区（内容是若干次发布之前的旧数据）
+    T& getWriteBuffer() { return buffers[back]; }
+
+    // 写线程：发布写好的缓冲区
+    void publish() {
+        std::uint8_t previous = middle.exchange(static_cast<std::uint8_t>(back | FRESH),
+                                                std::memory_order_acq_rel);
+        back = previous & INDEX_MASK;
+    }
+
+    // 读线程：有新数据时切换到最新发布的缓冲区，返回是否切换
+    bool acquire() {
+        if (!(middle.load(std::memory_order_relaxed) & FRESH)) {
+            return false;
+        }
+
+        std::uint8_t previous = middle.exchange(front, std::memory_order_acq_rel);
+        front = previous & INDEX_MASK;
+        return true;
+    }
+
+    // 读线程：最近一次取得的缓冲区（写线程不会修改它）
+    const T& getReadBuffer() const { return buffers[front]; }
+
+    // 初始化时对所有缓冲区执行同一操作（例如预留容量），必须在两个线程开始工作之前调用
+    template <typename Function>
+    void forEach(Function function) {
+        for (T& buffer : buffers) {
+            function(buffer);
+        }
+    }
+
+private:
+    static constexpr std::uint8_t INDEX_MASK = 0x3;
+    static constexpr std::uint8_t FRESH = 0x4;  // 中间缓冲区是否有读线程还没取走的数据
+
+    T buffers[3];
+
+    // 中间缓冲区下标 | FRESH
+    std::atomic<std::uint8_t> middle;
+
+    std::uint8_t back;   // 只由写线程访问
+    std::uint8_t front;  // 只由读线程访问
+};
+
+#endif